@@ -14,68 +14,163 @@
 *
 * Notes:
 *   - The class BigInt primarily interacts with its data through chunked vectors. These vectors
-*	  store segments of the large number.
+*	  store segments of the large number, least significant chunk first.
 *   - The multiplication method uses traditional schoolbook multiplication, adjusted for chunked
-*	  data.
-*	- The powerOf method implements the Exponentiation by Squaring technique.
+*	  data, and hands operands larger than the Karatsuba threshold to the multiplication dispatcher
+*	  in BigIntKernels, which picks between Karatsuba, Toom-3, Toom-4 and a number-theoretic transform.
+*	- The square method has its own kernels that skip the duplicated work of multiplying a number
+*	  by itself, and is what the squaring steps of powerOf use.
+*	- The powerOf method implements the Exponentiation by Squaring technique, iterating over the
+*	  bits of the exponent, with sliding windows for bases larger than one chunk.
 *	- Operator overloads are included for intuitive usage of operations like multiplication.
+*	- The powMod method reduces after every step, in Montgomery form when the modulus allows it and
+*	  with Barrett's reduction otherwise.
+*	- Values are signed. The kernels work on the magnitudes, and each operation settles the sign of
+*	  its result separately.
 *
 ***************************************************************************************************/
 
 #include "BigInt.hpp"
+#include <type_traits>
+#include <bit>
+
+// Vectors of BigInts, like the odd power tables, only move their elements on reallocation if moving cannot throw
+static_assert(std::is_nothrow_move_constructible_v<BigInt> && std::is_nothrow_move_assignable_v<BigInt>,
+    "BigInt temporaries must be movable without copying their chunks");
+
+// The multiplication thresholds are picked once the instruction set of the host is known
+static const bool hasSimdMultiply = BigIntKernels::GetSupportedSimdLevel() >= BigIntKernels::SIMD_MULTIPLY_LEVEL;
+size_t BigInt::karatsubaThreshold = hasSimdMultiply ? KARATSUBA_THRESHOLD_SIMD : KARATSUBA_THRESHOLD_DEFAULT;
+size_t BigInt::toom3Threshold = hasSimdMultiply ? TOOM3_THRESHOLD_SIMD : TOOM3_THRESHOLD_DEFAULT;
+size_t BigInt::toom4Threshold = hasSimdMultiply ? TOOM4_THRESHOLD_SIMD : TOOM4_THRESHOLD_DEFAULT;
+size_t BigInt::nttThreshold = hasSimdMultiply ? NTT_THRESHOLD_SIMD : NTT_THRESHOLD_DEFAULT;
+size_t BigInt::burnikelZieglerThreshold = BURNIKEL_ZIEGLER_THRESHOLD_DEFAULT;
+size_t BigInt::newtonDivisionThreshold = NEWTON_DIVISION_THRESHOLD_DEFAULT;
 
 // Operator overrides for printing to terminal using <<
-std::ostream& operator<<(std::ostream& os, const std::vector<int>& bigIntVectoredChunks) {
-    for (int chunk : bigIntVectoredChunks) {
+std::ostream& operator<<(std::ostream& os, const BigInt::LimbVector& bigIntVectoredChunks) {
+    for (BigInt::Limb chunk : bigIntVectoredChunks) {
         os << chunk << std::endl;
     }
     return os;
 }
 
 std::ostream& operator<<(std::ostream& os, const BigInt& bigInt) {
-    os << "BigInt Full String is: " << bigInt.bigIntStr << std::endl;
+    os << "BigInt Full String is: " << bigInt.GetBigIntFullString() << std::endl;
     os << "BigInt Vectored Chunks are: " << std::endl;
-    for (int chunk : bigInt.bigIntVecChunks) {
+    for (BigInt::Limb chunk : bigInt.bigIntVecChunks) {
         os << chunk << std::endl;
     }
     return os;
 }
 
 // Functions to fetch class parameters
-std::vector<int> BigInt::GetBigIntVectoredChunks() {
-    return this->bigIntVecChunks;
+std::span<const BigInt::Limb> BigInt::GetBigIntVectoredChunks() const {
+    return std::span<const BigInt::Limb>(this->bigIntVecChunks.data(), this->bigIntVecChunks.size());
 }
-std::string BigInt::GetBigIntFullString() {
+const std::string& BigInt::GetBigIntFullString() const {
+    // The string is built from the chunks the first time it is asked for, and reused afterwards
+    if (!isBigIntStrCached) {
+        BigInt::LimbVector scratch;
+        bigIntStr = BigIntKernels::FormatDecimal(bigIntVecChunks.AsVector(scratch), GetMultiplyConfig());
+        if (isNegative) {
+            bigIntStr.insert(bigIntStr.begin(), '-');
+        }
+        isBigIntStrCached = true;
+    }
     return this->bigIntStr;
 }
+bool BigInt::IsNegative() const {
+    return this->isNegative;
+}
 int BigInt::GetChunkSize() {
     return this->chunkSize;
 }
+size_t BigInt::GetKaratsubaThreshold() {
+    return karatsubaThreshold;
+}
+size_t BigInt::GetToom3Threshold() {
+    return toom3Threshold;
+}
+size_t BigInt::GetToom4Threshold() {
+    return toom4Threshold;
+}
+size_t BigInt::GetNttThreshold() {
+    return nttThreshold;
+}
+size_t BigInt::GetBurnikelZieglerThreshold() {
+    return burnikelZieglerThreshold;
+}
+size_t BigInt::GetNewtonDivisionThreshold() {
+    return newtonDivisionThreshold;
+}
 
 // Functions to set class parameters
-void BigInt::SetBigIntVecChunksFromStr(std::string numStr) {
-    // First make sure that numStr has a length of 3
-    while (numStr.size() % chunkSize != 0) {
-        numStr = "0" + numStr;
+void BigInt::SetBigIntVecChunksFromStr(std::string_view numStr) {
+    // A leading minus sign sets the sign, and the digits after it are parsed in place as the magnitude, in linear
+    // time for decimal chunks and by divide and conquer for binary chunks
+    bool hasMinusSign = !numStr.empty() && numStr[0] == '-';
+    size_t firstDigit = hasMinusSign ? 1 : 0;
+    if (hasMinusSign && numStr.size() == 1) {
+        throw std::invalid_argument("BigInt string has a minus sign but no digits");
     }
-
-    // Next, split numStr into chunks of three digits and store it in bigIntVectoredChunks
-    for (int i = 0; i < numStr.size(); i += chunkSize) {
-        bigIntVecChunks.push_back(std::stoi(numStr.substr(i, chunkSize)));
+    size_t numDigits = numStr.size() - firstDigit;
+    if (numDigits > 0 && numDigits <= 19) {
+        // Up to 19 digits fit in a word, which is split into chunks inline without going through a vector
+        BigInt::Limb wordChunks[BigIntKernels::MAX_WORD_CHUNKS];
+        size_t chunkCount = BigIntKernels::ChunksFromWord(BigIntKernels::ParseDecimalWord(numStr.data() + firstDigit, numDigits), wordChunks);
+        bigIntVecChunks.assign(wordChunks, wordChunks + chunkCount);
     }
+    else {
+        bigIntVecChunks = ChunkBuffer(BigIntKernels::ParseDecimal(numStr.data() + firstDigit, numDigits, GetMultiplyConfig()));
+    }
+    isNegative = hasMinusSign;
+    normalizeAfterUpdate();
 }
-void BigInt::SetBigIntStrFromVec(std::vector<int>& numVec) {
-    bigIntStr = "";
-    for (int chunk : numVec) {
-        std::string chunkStr = std::to_string(chunk);
-        while ((chunk != numVec[0]) && (chunkStr.size() % chunkSize != 0)) {
-            chunkStr = "0" + chunkStr;
-        }
-        bigIntStr += chunkStr;
+void BigInt::SetBigIntStrFromVec(const BigInt::LimbVector& numVec) {
+    // The digits are written straight into a preallocated string, by divide and conquer for binary chunks
+    bigIntStr = BigIntKernels::FormatDecimal(numVec, GetMultiplyConfig());
+    if (isNegative) {
+        bigIntStr.insert(bigIntStr.begin(), '-');
     }
+    isBigIntStrCached = true;
+}
+void BigInt::SetKaratsubaThreshold(size_t newThreshold) {
+    karatsubaThreshold = newThreshold;
+}
+void BigInt::SetToom3Threshold(size_t newThreshold) {
+    toom3Threshold = newThreshold;
+}
+void BigInt::SetToom4Threshold(size_t newThreshold) {
+    toom4Threshold = newThreshold;
+}
+void BigInt::SetNttThreshold(size_t newThreshold) {
+    nttThreshold = newThreshold;
+}
+void BigInt::SetBurnikelZieglerThreshold(size_t newThreshold) {
+    burnikelZieglerThreshold = newThreshold;
 }
-void BigInt::SetChunkSize(int newChunkSize) {
-    this->chunkSize = newChunkSize;
+void BigInt::SetNewtonDivisionThreshold(size_t newThreshold) {
+    newtonDivisionThreshold = newThreshold;
+}
+
+BigIntKernels::MultiplyConfig BigInt::GetMultiplyConfig() const {
+    BigIntKernels::MultiplyConfig config = { karatsubaThreshold, toom3Threshold, toom4Threshold, nttThreshold,
+        burnikelZieglerThreshold, newtonDivisionThreshold };
+    return config;
+}
+
+void BigInt::normalizeAfterUpdate() {
+    while (bigIntVecChunks.size() > 1 && bigIntVecChunks.back() == 0) {
+        bigIntVecChunks.pop_back();
+    }
+    if (bigIntVecChunks.empty()) {
+        bigIntVecChunks.push_back(0);
+    }
+    if (bigIntVecChunks.size() == 1 && bigIntVecChunks[0] == 0) {
+        isNegative = false;
+    }
+    isBigIntStrCached = false;
 }
 
 // Functions for solving the numerical problem, requiring one for multiplication and one for exponentiation
@@ -87,67 +182,542 @@ void BigInt::SetChunkSize(int newChunkSize) {
 *   - The flow of operations is exactly the same as how grade-school multiplication is performed, with 
 *     the difference being that each multiplied entity has a number of digits defined by the CHUNK_SIZE_DEFAULT
 *     parameter defined in BigInt.hpp. 
+*   - Once both operands have at least karatsubaThreshold chunks, the kernel dispatcher moves on to
+*     Karatsuba, Toom-3, Toom-4 and the number-theoretic transform at their own thresholds.
+*   - The chunks are stored least significant first, which is also the order the kernels work in, so the
+*     operands are passed straight through.
 */
-std::vector<int> BigInt::multiply(const std::vector<int>& num1, const std::vector<int>& num2) const {
-    size_t num1VectorSize = num1.size();
-    size_t num2VectorSize = num2.size();
-    std::vector<int> result(num1VectorSize + num2VectorSize, 0);
+BigInt::LimbVector BigInt::multiply(const BigInt::LimbVector& num1, const BigInt::LimbVector& num2) const {
+    BigInt::LimbVector result = BigIntKernels::Multiply(num1.data(), num1.size(), num2.data(), num2.size(), GetMultiplyConfig());
 
-    for (int i = num2VectorSize - 1; i >= 0; i--) {
-        for (int j = num1VectorSize - 1; j >= 0; j--) {
-            int positionOfCarryOver = i + j;
-            int positionOfMultiplication = i + j + 1;
-            int multiplicationOfChunks = num1[j] * num2[i];
-            multiplicationOfChunks += result[positionOfMultiplication];
+    // Remove leading zero chunks from the result vector, which sit at its end. A single zero chunk is kept for zero.
+    // I.e if result = [123, 1, 0, 0, 0], after this it will be result = [123, 1]
+    while (result.size() > 1 && result.back() == 0) {
+        result.pop_back();
+    }
+    return result;
+}
 
-            result[positionOfMultiplication] = multiplicationOfChunks % (int)std::pow(10, chunkSize);
-            result[positionOfCarryOver] += multiplicationOfChunks / (int)std::pow(10, chunkSize);
-        }
+// Squaring uses the same tiers as multiplication, but every tier has a kernel that only needs the one operand.
+BigInt::LimbVector BigInt::square(const BigInt::LimbVector& num) const {
+    BigInt::LimbVector result = BigIntKernels::Square(num.data(), num.size(), GetMultiplyConfig());
+    while (result.size() > 1 && result.back() == 0) {
+        result.pop_back();
     }
+    return result;
+}
 
-    // Remove leading zero elements from the result vector.
-    // I.e if result = [0, 0, 0, 1, 123], after this it will be result = [1, 123]
-    // Find the first non-zero element using a simple lambda function
-    std::vector<int>::iterator it = std::find_if(result.begin(), result.end(), [](int num) {
-        return num != 0;
-        });
+ChunkBuffer BigInt::multiplyChunks(const BigInt::Limb* num1, size_t num1Size, const BigInt::Limb* num2, size_t num2Size) const {
+    if (num1Size + num2Size <= ChunkBuffer::INLINE_CAPACITY) {
+        ChunkBuffer product;
+        product.resize(num1Size + num2Size);
+        BigIntKernels::MultiplyTo(num1, num1Size, num2, num2Size, product.data(), GetMultiplyConfig());
+        return product;
+    }
+    return ChunkBuffer(BigIntKernels::Multiply(num1, num1Size, num2, num2Size, GetMultiplyConfig()));
+}
 
-    // Erase the elements before the first non-zero element
-    if (it != result.end()) {
-        result.erase(result.begin(), it);
+BigInt BigInt::square() const {
+    const ChunkBuffer& chunks = this->bigIntVecChunks;
+    if (2 * chunks.size() <= ChunkBuffer::INLINE_CAPACITY) {
+        return BigInt(multiplyChunks(chunks.data(), chunks.size(), chunks.data(), chunks.size()), false);
     }
-    return result;
+    return BigInt(ChunkBuffer(BigIntKernels::Square(chunks.data(), chunks.size(), GetMultiplyConfig())), false);
 }
 
 /* Exponentiation by Squaring technique:
 *   This approach takes advantage of the fact that any number can be represented as a sum of powers of 
-*   two. Further, it is a recursive implementation that drastically reduces the number of computations.
+*   two. The exponent is walked from its most significant bit down: every bit squares the running result,
+*   and the set bits multiply it by the base. The loop works on the chunk vectors directly, so no
+*   intermediate BigInt is built and the only buffers are the running result and the kernel output that
+*   replaces it at each step.
+*   - A single-chunk base (every input of the application) is multiplied in one bit at a time with the
+*     scalar multiply-by-word kernel, which is a single linear pass over the result.
+*   - A larger base uses sliding windows: runs of up to k bits that end in a set bit are multiplied in
+*     at once from a table of the odd powers of the base, which cuts the number of full multiplications
+*     by about a factor of k + 1. Fixed k-ary windows would need a table twice the size for the same k.
+*   - The size of the power is known up front from log(base) * exponent, so the running result and a
+*     scratch buffer are both reserved once at that size. Every product is written into the scratch
+*     buffer and the two are swapped, so no step reallocates them.
 */
 BigInt BigInt::powerOf(const int exponent) const {
-    int halfOfExp = exponent / 2;
-    BigInt result("1");
+    if (exponent < 0) {
+        throw std::invalid_argument("BigInt::powerOf requires a non-negative exponent");
+    }
     if (exponent == 0) {
-        return result;
+        return BigInt(BigInt::LimbVector(1, 1));
+    }
+    // The exponentiation runs on the magnitude, and an odd power keeps the sign of the base
+    bool isResultNegative = isNegative && (exponent % 2 == 1);
+
+    int topBit = 0;
+    while ((exponent >> topBit) > 1) {
+        topBit++;
     }
+    BigIntKernels::MultiplyConfig config = GetMultiplyConfig();
+    bool isSingleChunkBase = this->bigIntVecChunks.size() == 1;
+    int windowWidth = isSingleChunkBase ? 1 : BigIntKernels::SlidingWindowWidth(topBit + 1);
 
-    BigInt powerToHalfOfExp = this->powerOf(halfOfExp);
+    // The temporaries of every product are bump-allocated from this thread's ScratchArena, which takes them all back
+    // when the power is done. The buffers that last the whole exponentiation come from the heap instead, so that
+    // each product leaves the arena empty for the next one.
+    ScratchArena::Scope scratchScope;
+    BigInt::LimbVector result;
+    BigInt::LimbVector scratch;
+    // oddPowers[i] holds base^(2i + 1)
+    std::vector<BigInt::LimbVector> oddPowers;
+    {
+        ScratchArena::Suspend suspend;
+        oddPowers.emplace_back(this->bigIntVecChunks.begin(), this->bigIntVecChunks.end());
+        const BigInt::LimbVector& base = oddPowers[0];
 
-    if (exponent % 2 == 0) {
-        // even exponent
-        result = powerToHalfOfExp * powerToHalfOfExp;
-        return result;
+        // |base| < (top + 1) * LIMB_BASE^(n - 1) for its n chunks, which bounds the chunks of the power. The bound
+        // only sizes the buffers, and a product needs up to one chunk more than its value before it is trimmed.
+        double baseLog = (double)(base.size() - 1) + std::log((double)base.back() + 1) / std::log((double)BigIntKernels::LIMB_BASE);
+        size_t predictedChunks = (size_t)(exponent * baseLog) + 3;
+        result.reserve(predictedChunks);
+        result.push_back(1);
+        scratch.reserve(predictedChunks);
+
+        if (windowWidth > 1) {
+            BigInt::LimbVector baseSquared = square(base);
+            while (oddPowers.size() < ((size_t)1 << (windowWidth - 1))) {
+                oddPowers.push_back(multiply(oddPowers.back(), baseSquared));
+            }
+        }
+    }
+
+    // Write result squared or result times factor into scratch, trim it and swap it in
+    auto squareResult = [&]() {
+        BigIntKernels::SquareInto(result.data(), result.size(), scratch, config);
+        while (scratch.size() > 1 && scratch.back() == 0) {
+            scratch.pop_back();
+        }
+        result.swap(scratch);
+    };
+    auto multiplyResult = [&](const BigInt::LimbVector& factor) {
+        BigIntKernels::MultiplyInto(result.data(), result.size(), factor.data(), factor.size(), scratch, config);
+        while (scratch.size() > 1 && scratch.back() == 0) {
+            scratch.pop_back();
+        }
+        result.swap(scratch);
+    };
+
+    bool isResultOne = true;
+    int bit = topBit;
+    while (bit >= 0) {
+        if (((exponent >> bit) & 1) == 0) {
+            squareResult();
+            bit--;
+            continue;
+        }
+
+        // The window runs from this set bit down to the lowest set bit at most windowWidth - 1 bits below it
+        int lowBit = std::max(bit - windowWidth + 1, 0);
+        while (((exponent >> lowBit) & 1) == 0) {
+            lowBit++;
+        }
+        int windowValue = (exponent >> lowBit) & ((1 << (bit - lowBit + 1)) - 1);
+        if (isResultOne) {
+            result.assign(oddPowers[windowValue >> 1].begin(), oddPowers[windowValue >> 1].end());
+            isResultOne = false;
+        }
+        else {
+            for (int i = lowBit; i <= bit; i++) {
+                squareResult();
+            }
+            if (isSingleChunkBase) {
+                BigIntKernels::MultiplyAddWordInPlace(result, oddPowers[0][0], 0);
+            }
+            else {
+                multiplyResult(oddPowers[windowValue >> 1]);
+            }
+        }
+        bit = lowBit - 1;
+    }
+    // The result is copied out, as the products may have moved it into the arena if the prediction fell short
+    ScratchArena::Suspend suspend;
+    return BigInt(BigInt::LimbVector(result), isResultNegative);
+}
+
+size_t BigInt::decimalDigitCount() const {
+#ifdef BIGINT_BINARY_LIMBS
+    // A value of bitCount bits has between (bitCount - 1) * log10(2) + 1 and bitCount * log10(2) + 1 digits, which
+    // are widened a little against rounding. Where they differ the value is compared with powers of ten.
+    const ChunkBuffer& chunks = bigIntVecChunks;
+    size_t bitCount = (chunks.size() - 1) * 64 + (size_t)std::bit_width(chunks.back());
+    if (bitCount <= 1) {
+        return 1;
+    }
+    const double log10Of2 = 0.30102999566398119521;
+    size_t digitCount = (size_t)std::floor((double)(bitCount - 1) * log10Of2 - 1e-6) + 1;
+    size_t maxDigitCount = (size_t)std::floor((double)bitCount * log10Of2 + 1e-6) + 1;
+    while (digitCount < maxDigitCount) {
+        BigInt powerOfTen("1" + std::string(digitCount, '0'));
+        const ChunkBuffer& powerChunks = powerOfTen.bigIntVecChunks;
+        if (BigIntKernels::Compare(chunks.data(), chunks.size(), powerChunks.data(), powerChunks.size()) < 0) {
+            break;
+        }
+        digitCount++;
+    }
+    return digitCount;
+#else
+    size_t digitCount = (bigIntVecChunks.size() - 1) * BigIntKernels::DIGITS_PER_LIMB;
+    for (BigInt::Limb topChunk = bigIntVecChunks.back(); topChunk >= 10; topChunk /= 10) {
+        digitCount++;
+    }
+    return digitCount + 1;
+#endif
+}
+
+/* Power Size Estimation Overview:
+*   - The logarithm of the power is carried implicitly: every step of the exponentiation by squaring is
+*     applied to a lower and an upper bound of the power, scaled by a power of ten, and both are cut back
+*     to precisionDigits digits afterwards, rounding the lower bound down and the upper bound up.
+*   - Each cut costs a relative error of at most 10^-(precisionDigits - 1), and the squarings double the
+*     errors accumulated so far, so the final bounds are within about exponent * 10^-(precisionDigits - 1)
+*     of each other. A guard of the exponent's digit count plus ten digits past the requested ones makes
+*     them agree on the digit count and the leading digits unless the power sits very close to a boundary.
+*   - When they disagree, the guard is doubled, and after a few attempts the full power is computed.
+*/
+void BigInt::boundPower(int exponent, size_t precisionDigits, BigInt& lower, BigInt& upper, size_t& powerOfTen) const {
+    BigInt zero("0");
+    auto truncate = [&](BigInt& lowerValue, BigInt& upperValue, size_t& valuePowerOfTen) {
+        size_t digitCount = lowerValue.decimalDigitCount();
+        if (digitCount <= precisionDigits) {
+            return;
+        }
+        size_t droppedDigits = digitCount - precisionDigits;
+        BigInt scale("1" + std::string(droppedDigits, '0'));
+        lowerValue = lowerValue / scale;
+        std::pair<BigInt, BigInt> upperDivided = upperValue.divmod(scale);
+        upperValue = upperDivided.first;
+        if (!(upperDivided.second == zero)) {
+            upperValue += 1;
+        }
+        valuePowerOfTen += droppedDigits;
+    };
+
+    BigInt baseLower = isNegative ? -*this : *this;
+    BigInt baseUpper = baseLower;
+    size_t basePowerOfTen = 0;
+    truncate(baseLower, baseUpper, basePowerOfTen);
+
+    lower = BigInt("1");
+    upper = BigInt("1");
+    powerOfTen = 0;
+    int topBit = 0;
+    while ((exponent >> topBit) > 1) {
+        topBit++;
+    }
+    for (int bit = (exponent == 0 ? -1 : topBit); bit >= 0; bit--) {
+        lower = lower.square();
+        upper = upper.square();
+        powerOfTen *= 2;
+        truncate(lower, upper, powerOfTen);
+        if (((exponent >> bit) & 1) == 1) {
+            lower = lower * baseLower;
+            upper = upper * baseUpper;
+            powerOfTen += basePowerOfTen;
+            truncate(lower, upper, powerOfTen);
+        }
+    }
+}
+
+std::string BigInt::estimatePower(int exponent, size_t leadingDigitCount, size_t& totalDigitCount) const {
+    if (exponent < 0) {
+        throw std::invalid_argument("BigInt::powerDigitCount and powerLeadingDigits require a non-negative exponent");
+    }
+    size_t guardDigits = std::to_string(exponent).size() + 10;
+    for (int attempt = 0; attempt < 3; attempt++, guardDigits *= 2) {
+        BigInt lower, upper;
+        size_t powerOfTen = 0;
+        boundPower(exponent, leadingDigitCount + guardDigits, lower, upper, powerOfTen);
+
+        // Every integer between two bounds of the same length that share their first digits has those digits too
+        std::string lowerStr = lower.GetBigIntFullString();
+        std::string upperStr = upper.GetBigIntFullString();
+        size_t comparedDigits = std::min(leadingDigitCount, lowerStr.size());
+        if (lowerStr.size() == upperStr.size() && lowerStr.compare(0, comparedDigits, upperStr, 0, comparedDigits) == 0) {
+            totalDigitCount = lowerStr.size() + powerOfTen;
+            return lowerStr.substr(0, comparedDigits);
+        }
+    }
+
+    // The power is too close to a boundary for the bounds to settle it, so it is computed exactly
+    std::string fullStr = (isNegative ? -*this : *this).powerOf(exponent).GetBigIntFullString();
+    totalDigitCount = fullStr.size();
+    return fullStr.substr(0, std::min(leadingDigitCount, fullStr.size()));
+}
+
+size_t BigInt::powerDigitCount(int exponent) const {
+    size_t totalDigitCount = 0;
+    estimatePower(exponent, 1, totalDigitCount);
+    return totalDigitCount;
+}
+
+std::string BigInt::powerLeadingDigits(int exponent, size_t digitCount) const {
+    size_t totalDigitCount = 0;
+    return estimatePower(exponent, digitCount, totalDigitCount);
+}
+
+std::pair<size_t, std::string> BigInt::powerDigitCountAndLeadingDigits(int exponent, size_t digitCount) const {
+    size_t totalDigitCount = 0;
+    std::string leadingDigits = estimatePower(exponent, digitCount, totalDigitCount);
+    return { totalDigitCount, leadingDigits };
+}
+
+// Modular exponentiation. The base is first reduced into [0, modulus), then the kernel keeps every
+// intermediate reduced, so the work depends on the modulus size rather than on the size of the full power.
+BigInt BigInt::powMod(const BigInt& exponent, const BigInt& modulus) const {
+    if (modulus.isNegative || BigIntKernels::Compare(modulus.bigIntVecChunks.data(), modulus.bigIntVecChunks.size(), nullptr, 0) == 0) {
+        throw std::invalid_argument("BigInt::powMod requires a positive modulus");
+    }
+    if (exponent.isNegative) {
+        throw std::invalid_argument("BigInt::powMod requires a non-negative exponent");
+    }
+    BigInt base = *this % modulus;
+    if (base.isNegative) {
+        base += modulus;
+    }
+    BigInt::LimbVector baseScratch, exponentScratch, modulusScratch;
+    BigInt::LimbVector result = BigIntKernels::PowMod(base.bigIntVecChunks.AsVector(baseScratch), exponent.bigIntVecChunks.AsVector(exponentScratch),
+        modulus.bigIntVecChunks.AsVector(modulusScratch), nullptr, GetMultiplyConfig());
+    if (result.empty()) {
+        result.push_back(0);
+    }
+    return BigInt(std::move(result));
+}
+
+// Operator override for multiplication, the sign of the product is negative when exactly one operand is
+BigInt BigInt::operator*(const BigInt& rhsOfMultiplyOperator) const {
+    const ChunkBuffer& rhsChunks = rhsOfMultiplyOperator.bigIntVecChunks;
+    return BigInt(multiplyChunks(this->bigIntVecChunks.data(), this->bigIntVecChunks.size(), rhsChunks.data(), rhsChunks.size()),
+        this->isNegative != rhsOfMultiplyOperator.isNegative);
+}
+
+// Operator override for negation. A temporary is negated in place, and keeps its cached string when it has one.
+BigInt BigInt::operator-() const& {
+    BigInt result = *this;
+    return -std::move(result);
+}
+
+BigInt BigInt::operator-() && {
+    if (BigIntKernels::Compare(this->bigIntVecChunks.data(), this->bigIntVecChunks.size(), nullptr, 0) != 0) {
+        this->isNegative = !this->isNegative;
+        if (this->isBigIntStrCached) {
+            if (this->isNegative) {
+                this->bigIntStr.insert(this->bigIntStr.begin(), '-');
+            }
+            else {
+                this->bigIntStr.erase(this->bigIntStr.begin());
+            }
+        }
+    }
+    return std::move(*this);
+}
+
+/* Signed Addition:
+*   - Operands with the same sign have their magnitudes added and keep that sign.
+*   - Otherwise the smaller magnitude is subtracted from the larger one, and the result takes the sign of
+*     the operand with the larger magnitude. When that is the right-hand side, its magnitude is copied so
+*     that the subtraction still runs in place.
+*/
+void BigInt::addSignedInPlace(const BigInt::Limb* rhsChunks, size_t rhsSize, bool rhsIsNegative) {
+    ChunkBuffer& chunks = this->bigIntVecChunks;
+    if (rhsChunks == chunks.data()) {
+        // Growing the chunk buffer would invalidate rhsChunks, so A += A works on a copy
+        ChunkBuffer rhsCopy = chunks;
+        addSignedInPlace(rhsCopy.data(), rhsCopy.size(), rhsIsNegative);
+        return;
+    }
+    if (this->isNegative == rhsIsNegative) {
+        // The buffer only grows for a longer right-hand side or a carry out of the top chunk
+        if (chunks.size() < rhsSize) {
+            chunks.resize(rhsSize, 0);
+        }
+        BigInt::Limb carry = BigIntKernels::AddInPlace(chunks.data(), chunks.size(), rhsChunks, rhsSize);
+        if (carry != 0) {
+            chunks.push_back(carry);
+        }
+    }
+    else if (BigIntKernels::Compare(chunks.data(), chunks.size(), rhsChunks, rhsSize) >= 0) {
+        BigIntKernels::SubtractInPlace(chunks.data(), chunks.size(), rhsChunks, rhsSize);
     }
     else {
-        // odd exponent
-        result = powerToHalfOfExp * powerToHalfOfExp;
-        result = (*this) * result;
-        return result;
+        ChunkBuffer difference;
+        difference.assign(rhsChunks, rhsChunks + rhsSize);
+        BigIntKernels::SubtractInPlace(difference.data(), difference.size(), chunks.data(), chunks.size());
+        std::swap(chunks, difference);
+        this->isNegative = rhsIsNegative;
     }
+    normalizeAfterUpdate();
+}
+
+// Operator overrides for addition and subtraction, which all go through addSignedInPlace. The in-place forms
+// only grow the existing vector by at most one chunk, and a temporary left-hand side is updated in place.
+BigInt BigInt::operator+(const BigInt& rhsOfAddOperator) const& {
+    BigInt result = *this;
+    result += rhsOfAddOperator;
     return result;
 }
 
-// Operator override for multiplication
-BigInt BigInt::operator*(const BigInt& rhsOfMultiplyOperator) const {
-    std::vector<int> multiplyResult = multiply(this->bigIntVecChunks, rhsOfMultiplyOperator.bigIntVecChunks);
-    return BigInt(multiplyResult);
+BigInt BigInt::operator+(const BigInt& rhsOfAddOperator) && {
+    *this += rhsOfAddOperator;
+    return std::move(*this);
+}
+
+BigInt BigInt::operator-(const BigInt& rhsOfSubtractOperator) const& {
+    BigInt result = *this;
+    result -= rhsOfSubtractOperator;
+    return result;
+}
+
+BigInt BigInt::operator-(const BigInt& rhsOfSubtractOperator) && {
+    *this -= rhsOfSubtractOperator;
+    return std::move(*this);
+}
+
+BigInt& BigInt::operator+=(const BigInt& rhsOfAddOperator) {
+    addSignedInPlace(rhsOfAddOperator.bigIntVecChunks.data(), rhsOfAddOperator.bigIntVecChunks.size(), rhsOfAddOperator.isNegative);
+    return *this;
+}
+
+BigInt& BigInt::operator-=(const BigInt& rhsOfSubtractOperator) {
+    // A -= A passes the chunks of this object as the right-hand side, which addSignedInPlace copies first
+    addSignedInPlace(rhsOfSubtractOperator.bigIntVecChunks.data(), rhsOfSubtractOperator.bigIntVecChunks.size(), !rhsOfSubtractOperator.isNegative);
+    return *this;
+}
+
+// Operator overrides for division. The kernels divide the magnitudes, and the signs follow truncation toward zero.
+std::pair<BigInt, BigInt> BigInt::divmod(const BigInt& divisor) const {
+    const ChunkBuffer& divisorChunks = divisor.bigIntVecChunks;
+    if (BigIntKernels::Compare(divisorChunks.data(), divisorChunks.size(), nullptr, 0) == 0) {
+        throw std::invalid_argument("BigInt division by zero");
+    }
+    if (divisorChunks.size() == 1) {
+        // A single-chunk divisor is a linear pass over a copy of the dividend, which stays inline for small values
+        ChunkBuffer quotientChunks = this->bigIntVecChunks;
+        BigInt::Limb remainderChunk = BigIntKernels::DivideByWordInPlace(quotientChunks.data(), quotientChunks.size(), divisorChunks[0]);
+        ChunkBuffer remainderChunks;
+        remainderChunks.push_back(remainderChunk);
+        return std::make_pair(BigInt(std::move(quotientChunks), this->isNegative != divisor.isNegative),
+            BigInt(std::move(remainderChunks), this->isNegative));
+    }
+    const ChunkBuffer& dividendChunks = this->bigIntVecChunks;
+    if (dividendChunks.size() < ChunkBuffer::INLINE_CAPACITY) {
+        // Short values are divided in copies that stay inline, with room for the extra chunk the division needs
+        ChunkBuffer quotientChunks;
+        ChunkBuffer remainderChunks = dividendChunks;
+        if (BigIntKernels::Compare(dividendChunks.data(), dividendChunks.size(), divisorChunks.data(), divisorChunks.size()) >= 0) {
+            ChunkBuffer scaledDivisor = divisorChunks;
+            quotientChunks.resize(dividendChunks.size() - divisorChunks.size() + 1);
+            remainderChunks.push_back(0);
+            BigIntKernels::SchoolbookDivideInPlace(remainderChunks.data(), dividendChunks.size(), scaledDivisor.data(), scaledDivisor.size(),
+                quotientChunks.data());
+            remainderChunks.resize(divisorChunks.size());
+        }
+        return std::make_pair(BigInt(std::move(quotientChunks), this->isNegative != divisor.isNegative),
+            BigInt(std::move(remainderChunks), this->isNegative));
+    }
+    BigInt::LimbVector dividendScratch, divisorScratch;
+    BigInt::LimbVector quotientChunks, remainderChunks;
+    BigIntKernels::Divide(this->bigIntVecChunks.AsVector(dividendScratch), divisorChunks.AsVector(divisorScratch), quotientChunks, remainderChunks, GetMultiplyConfig());
+    if (quotientChunks.empty()) {
+        quotientChunks.push_back(0);
+    }
+    if (remainderChunks.empty()) {
+        remainderChunks.push_back(0);
+    }
+    return std::make_pair(BigInt(std::move(quotientChunks), this->isNegative != divisor.isNegative),
+        BigInt(std::move(remainderChunks), this->isNegative));
+}
+
+BigInt BigInt::operator/(const BigInt& rhsOfDivideOperator) const {
+    return divmod(rhsOfDivideOperator).first;
+}
+
+BigInt BigInt::operator%(const BigInt& rhsOfModuloOperator) const {
+    return divmod(rhsOfModuloOperator).second;
+}
+
+// Operator overrides for comparison. Zero is never negative, so differing signs decide the order on their own.
+std::strong_ordering BigInt::operator<=>(const BigInt& rhsOfCompareOperator) const {
+    if (this->isNegative != rhsOfCompareOperator.isNegative) {
+        return this->isNegative ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    const ChunkBuffer& rhsChunks = rhsOfCompareOperator.bigIntVecChunks;
+    int comparison = BigIntKernels::Compare(this->bigIntVecChunks.data(), this->bigIntVecChunks.size(), rhsChunks.data(), rhsChunks.size());
+    return this->isNegative ? (0 <=> comparison) : (comparison <=> 0);
+}
+
+bool BigInt::operator==(const BigInt& rhsOfCompareOperator) const {
+    return (*this <=> rhsOfCompareOperator) == 0;
+}
+
+// Operator overrides for arithmetic with native integers. A factor below the chunk base is a single
+// multiply-by-word pass; a larger one (only possible with decimal chunks) is split into its chunks first.
+BigInt& BigInt::operator*=(uint64_t factor) {
+    ChunkBuffer& chunks = this->bigIntVecChunks;
+    if (factor < BigIntKernels::LIMB_BASE) {
+        BigInt::Limb carry = BigIntKernels::MultiplyAddWordInPlace(chunks.data(), chunks.size(), (BigInt::Limb)factor, 0);
+        if (carry != 0) {
+            chunks.push_back(carry);
+        }
+    }
+    else {
+        BigInt::Limb factorChunks[BigIntKernels::MAX_WORD_CHUNKS];
+        size_t factorSize = BigIntKernels::ChunksFromWord(factor, factorChunks);
+        chunks = multiplyChunks(chunks.data(), chunks.size(), factorChunks, factorSize);
+    }
+    normalizeAfterUpdate();
+    return *this;
+}
+
+// The carry only runs past the addend's chunks for as long as it keeps overflowing, and the chunks are only
+// reallocated when it overflows the top one, so adding to a non-negative value is usually constant time
+BigInt& BigInt::operator+=(uint64_t addend) {
+    BigInt::Limb addendChunks[BigIntKernels::MAX_WORD_CHUNKS];
+    size_t addendSize = BigIntKernels::ChunksFromWord(addend, addendChunks);
+    addSignedInPlace(addendChunks, addendSize, false);
+    return *this;
+}
+
+// The magnitude of a negative operand is taken in unsigned arithmetic, so INT64_MIN is handled too
+BigInt& BigInt::operator*=(int64_t factor) {
+    *this *= (factor < 0) ? 0 - (uint64_t)factor : (uint64_t)factor;
+    if (factor < 0) {
+        this->isNegative = !this->isNegative;
+        normalizeAfterUpdate();
+    }
+    return *this;
+}
+
+BigInt& BigInt::operator+=(int64_t addend) {
+    BigInt::Limb addendChunks[BigIntKernels::MAX_WORD_CHUNKS];
+    size_t addendSize = BigIntKernels::ChunksFromWord((addend < 0) ? 0 - (uint64_t)addend : (uint64_t)addend, addendChunks);
+    addSignedInPlace(addendChunks, addendSize, addend < 0);
+    return *this;
+}
+
+BigInt BigInt::operator*(uint64_t factor) const& {
+    BigInt result = *this;
+    result *= factor;
+    return result;
+}
+
+BigInt BigInt::operator*(uint64_t factor) && {
+    *this *= factor;
+    return std::move(*this);
+}
+
+BigInt BigInt::operator+(uint64_t addend) const& {
+    BigInt result = *this;
+    result += addend;
+    return result;
+}
+
+BigInt BigInt::operator+(uint64_t addend) && {
+    *this += addend;
+    return std::move(*this);
 }
\ No newline at end of file
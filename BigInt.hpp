@@ -10,70 +10,276 @@
 *	various arithmetic operations.
 *
 * Notes:
-*   - The chunk size for breaking down numbers is defined as a macro with a default value of 3.
-*   - All internal calculations are performed using vectors, with their string representations
-*	  maintained within the object for external usage.
-*	- The class provides overloaded constructors for initialization from a string or a vector.
+*   - The chunk size for breaking down numbers is defined as a macro with a default value of 9, so
+*	  that each uint32_t chunk holds a base 10^9 digit and the product of two chunks fits in 64 bits.
+*   - Defining BIGINT_BINARY_LIMBS at build time switches to native uint64_t chunks of base 2^64 with
+*	  128-bit products. The value is then only converted to decimal when its string is built, and the
+*	  chunk size becomes the number of decimal digits (19) converted per step.
+*   - Chunks are stored least significant first, so carries run forward through the vector and
+*	  leading zero chunks are removed from its end.
+*   - Values are signed, in sign-magnitude form: the chunks hold the magnitude and a separate flag
+*	  holds the sign, so the kernels only ever see non-negative numbers.
+*   - Multiplication switches from schoolbook to Karatsuba once both operands have at least
+*	  KARATSUBA_THRESHOLD_DEFAULT chunks, and from Karatsuba to Toom-3 and Toom-4 at the
+*	  TOOM3_THRESHOLD_DEFAULT and TOOM4_THRESHOLD_DEFAULT sizes. Above NTT_THRESHOLD_DEFAULT chunks
+*	  an exact number-theoretic transform is used. The thresholds can be tuned at runtime for all
+*	  BigInts, and start from the _SIMD defaults on hosts where the vectorized schoolbook kernel of
+*	  BigIntSimd runs.
+*   - powMod computes modular powers in Montgomery form when the modulus is coprime to the chunk
+*	  base and short enough, and with Barrett's reduction after every product otherwise. ModContext
+*	  keeps the Barrett reciprocal of a modulus for repeated use.
+*   - powerDigitCount and powerLeadingDigits run the exponentiation on truncated lower and upper
+*	  bounds of a few more digits than requested, which settles the size and the leading digits of
+*	  the power at a tiny fraction of the cost of computing it.
+*   - Division uses schoolbook long division while the divisor or the quotient is shorter than
+*	  BURNIKEL_ZIEGLER_THRESHOLD_DEFAULT chunks, Burnikel-Ziegler recursive division above that, and
+*	  a Newton reciprocal from NEWTON_DIVISION_THRESHOLD_DEFAULT divisor chunks, all built on the
+*	  same multiplication kernels.
+*   - All internal calculations are performed using vectors. The string representation is only built
+*	  the first time it is requested, and is then cached within the object for external usage, so the
+*	  intermediate results of a calculation never pay for a decimal conversion.
+*	- The class provides overloaded constructors for initialization from a string view or a vector. A
+*	  vector passed as a temporary is moved into the object rather than copied, and the chunks and the
+*	  string are handed out as a span and a const reference, so no accessor copies a multi-megabyte buffer.
+*	- The chunks are kept in a ChunkBuffer, which stores values of up to ChunkBuffer::INLINE_CAPACITY
+*	  chunks inside the object. Together with the lazily built string, which fits the small string
+*	  buffer of std::string for short values, small BigInts are created, copied, added, subtracted,
+*	  compared, multiplied and divided by a single chunk without any heap allocation.
+*	- powerOf opens a ScratchArena Scope, so the temporaries of all its products are bump-allocated from
+*	  a per-thread arena. Only its result and the buffers that last the whole exponentiation come from
+*	  the heap.
+*	- BigInt has no user-declared copy or move members, so its implicit moves are used for every
+*	  temporary. The operators that copy their left-hand side and then update it have overloads for a
+*	  temporary left-hand side that update it in place instead.
 *	- Operator overloading is utilized to provide a more intuitive interface for some operations,
-*	  such as multiplication and printing.
+*	  such as multiplication, addition, subtraction, comparison and printing. Multiplying by or
+*	  adding a native integer works on the chunks directly in a single linear pass.
+*	- The three-way comparison operator needs C++20, which is what the Dockerfile builds with.
 *
 ***************************************************************************************************/
 
 #pragma once
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <iostream>
 #include <vector>
+#include <utility>
 #include <cmath>
+#include <cstdint>
+#include <compare>
+#include <concepts>
+#include <stdexcept>
+#include <span>
+#include "BigIntKernels.hpp"
+#include "BigIntSimd.hpp"
+#include "ChunkBuffer.hpp"
 
-#define CHUNK_SIZE_DEFAULT 3
+// Binary chunks carry more than twice the bits of decimal ones and each is split into four transform
+// pieces, so the transform, and with it Newton division, only pays off for much longer chunk vectors in binary mode
+#ifdef BIGINT_BINARY_LIMBS
+#define CHUNK_SIZE_DEFAULT 19
+#define NTT_THRESHOLD_DEFAULT 100000
+#define NEWTON_DIVISION_THRESHOLD_DEFAULT 1000000
+#else
+#define CHUNK_SIZE_DEFAULT 9
+#define NTT_THRESHOLD_DEFAULT 450
+#define NEWTON_DIVISION_THRESHOLD_DEFAULT 80000
+#endif
+#define KARATSUBA_THRESHOLD_DEFAULT 48
+#define TOOM3_THRESHOLD_DEFAULT 150
+#define TOOM4_THRESHOLD_DEFAULT 300
+#define BURNIKEL_ZIEGLER_THRESHOLD_DEFAULT 40
+
+// Defaults used instead of the ones above on hosts where BigIntKernels::SimdMultiply runs. The vectorized schoolbook
+// kernel stays ahead of the recursive tiers up to its SIMD_MULTIPLY_MAX_CHUNKS limit, and in decimal mode Karatsuba
+// on top of it beats Toom-Cook until the transform takes over
+#ifdef BIGINT_BINARY_LIMBS
+#define KARATSUBA_THRESHOLD_SIMD 256
+#define TOOM3_THRESHOLD_SIMD 512
+#define TOOM4_THRESHOLD_SIMD 1024
+#define NTT_THRESHOLD_SIMD NTT_THRESHOLD_DEFAULT
+#else
+#define KARATSUBA_THRESHOLD_SIMD 256
+#define TOOM3_THRESHOLD_SIMD 3000
+#define TOOM4_THRESHOLD_SIMD 3000
+#define NTT_THRESHOLD_SIMD 3000
+#endif
 
 class BigInt {
+public:
+	// Chunk type, uint32_t holding base 10^9 digits by default or uint64_t binary chunks in binary mode
+	typedef BigIntKernels::Limb Limb;
+	typedef BigIntKernels::LimbVector LimbVector;
 private:
-	std::vector<int> bigIntVecChunks;
-	std::string bigIntStr;
+	// Magnitude of the value, with its sign kept separately in isNegative. Zero is never negative.
+	ChunkBuffer bigIntVecChunks;
+	bool isNegative;
+	// Decimal string of the chunks, built on demand by GetBigIntFullString and valid while isBigIntStrCached is set
+	mutable std::string bigIntStr;
+	mutable bool isBigIntStrCached;
 	int chunkSize;
+	static size_t karatsubaThreshold;
+	static size_t toom3Threshold;
+	static size_t toom4Threshold;
+	static size_t nttThreshold;
+	static size_t burnikelZieglerThreshold;
+	static size_t newtonDivisionThreshold;
+
+	// Bundles the chunk base and the algorithm thresholds for the kernels in BigIntKernels
+	BigIntKernels::MultiplyConfig GetMultiplyConfig() const;
+
+	// ModContext reduces by a fixed modulus with the same kernels, directly on the chunks
+	friend class ModContext;
+
+	// Adds a signed magnitude into this value, the shared step of every addition and subtraction
+	void addSignedInPlace(const Limb* rhsChunks, size_t rhsSize, bool rhsIsNegative);
+
+	// Returns the product of two chunk buffers, written straight into the result when it fits inline
+	ChunkBuffer multiplyChunks(const Limb* num1, size_t num1Size, const Limb* num2, size_t num2Size) const;
+
+	// Takes over chunks that may have leading zero chunks, which are trimmed
+	BigInt(ChunkBuffer&& chunks, bool isNegativeValue) : bigIntVecChunks(std::move(chunks)) {
+		chunkSize = CHUNK_SIZE_DEFAULT;
+		isNegative = isNegativeValue;
+		normalizeAfterUpdate();
+	}
+
+	// Removes leading zero chunks, clears the sign of zero and drops the cached string after the chunks change
+	void normalizeAfterUpdate();
+
+	// Returns the number of decimal digits of the magnitude, from the chunks alone in decimal mode
+	size_t decimalDigitCount() const;
+
+	// Bounds |this| ^ exponent between lower * 10^powerOfTen and upper * 10^powerOfTen, each kept to about
+	// precisionDigits digits by truncating lower down and upper up after every step of the exponentiation
+	void boundPower(int exponent, size_t precisionDigits, BigInt& lower, BigInt& upper, size_t& powerOfTen) const;
+
+	// Shared step of powerDigitCount, powerLeadingDigits and powerDigitCountAndLeadingDigits, returning the leading digits and setting the digit count
+	std::string estimatePower(int exponent, size_t leadingDigitCount, size_t& totalDigitCount) const;
 public:
 	// Default constructor, use default string "0" to initialize bigInt
 	BigInt() {
-		std::string numStr = "0";
 		chunkSize = CHUNK_SIZE_DEFAULT;
+		SetBigIntVecChunksFromStr("0");
 		bigIntStr = "0";
-		SetBigIntVecChunksFromStr(bigIntStr);
+		isBigIntStrCached = true;
 	}
 
-	// Overloaded constructor 1, use input string to initialize bigInt
-	BigInt(std::string numStr) {
+	// Overloaded constructor 1, use input string, optionally starting with a minus sign, to initialize bigInt
+	BigInt(std::string_view numStr) {
 		chunkSize = CHUNK_SIZE_DEFAULT;
-		bigIntStr = numStr;
 		SetBigIntVecChunksFromStr(numStr);
+
+		// The input is only kept as the string when it is already how the value prints, without leading zeros or
+		// a negative zero. Otherwise the string is built on demand.
+		std::string_view digits = numStr.substr((!numStr.empty() && numStr[0] == '-') ? 1 : 0);
+		if (!digits.empty() && (digits[0] != '0' || numStr == "0")) {
+			bigIntStr = numStr;
+			isBigIntStrCached = true;
+		}
 	}
 
-	// Overloaded constructor 2, use input vector to initialize bigInt
-	BigInt(std::vector<int>& numVec) {
+	// Overloaded constructor 2, use input vector as the magnitude of bigInt, which is moved in when it is a temporary
+	// LimbVector and copied from a plain std::vector. Leading zero chunks are trimmed, as the kernels expect, and the
+	// string is left to be built on demand.
+	BigInt(LimbVector numVec, bool isNegativeValue = false) : bigIntVecChunks(std::move(numVec)) {
 		chunkSize = CHUNK_SIZE_DEFAULT;
-		SetBigIntStrFromVec(numVec);
-		bigIntVecChunks = numVec;
+		isNegative = isNegativeValue;
+		normalizeAfterUpdate();
 	}
+	BigInt(const std::vector<Limb>& numVec, bool isNegativeValue = false) : BigInt(LimbVector(numVec.begin(), numVec.end()), isNegativeValue) {}
 
 	// Operator overrides for printing to terminal using <<
-	friend std::ostream& operator<<(std::ostream& os, const std::vector<int>& bigIntVectoredChunks);
+	friend std::ostream& operator<<(std::ostream& os, const BigInt::LimbVector& bigIntVectoredChunks);
 	friend std::ostream& operator<<(std::ostream& os, const BigInt& bigInt);
 
 	// Functions to fetch class parameters
-	std::vector<int> GetBigIntVectoredChunks();
-	std::string GetBigIntFullString();
+	std::span<const Limb> GetBigIntVectoredChunks() const;
+	const std::string& GetBigIntFullString() const;
+	bool IsNegative() const;
 	int GetChunkSize();
+	static size_t GetKaratsubaThreshold();
+	static size_t GetToom3Threshold();
+	static size_t GetToom4Threshold();
+	static size_t GetNttThreshold();
+	static size_t GetBurnikelZieglerThreshold();
+	static size_t GetNewtonDivisionThreshold();
 	
 	// Functions to set class parameters
-	void SetBigIntVecChunksFromStr(std::string fullNumStr);
-	void SetBigIntStrFromVec(std::vector<int>& numVec);
-	void SetChunkSize(int newChunkSize);
+	void SetBigIntVecChunksFromStr(std::string_view fullNumStr);
+	void SetBigIntStrFromVec(const LimbVector& numVec);
+	static void SetKaratsubaThreshold(size_t newThreshold);
+	static void SetToom3Threshold(size_t newThreshold);
+	static void SetToom4Threshold(size_t newThreshold);
+	static void SetNttThreshold(size_t newThreshold);
+	static void SetBurnikelZieglerThreshold(size_t newThreshold);
+	static void SetNewtonDivisionThreshold(size_t newThreshold);
 
 	// Functions for solving the numerical problem, requiring one for multiplication and one for exponentiation
-	std::vector<int> multiply(const std::vector<int>& num1, const std::vector<int>& num2) const;
+	LimbVector multiply(const LimbVector& num1, const LimbVector& num2) const;
+	LimbVector square(const LimbVector& num) const;
+	BigInt square() const;
 	BigInt powerOf(const int exponent) const;
 
+	// Return the number of decimal digits of this ^ exponent and its leading digitCount digits (all of them if it
+	// is shorter), without the sign and without computing the full power unless its bounds are too close to call.
+	// Throw std::invalid_argument for a negative exponent.
+	size_t powerDigitCount(int exponent) const;
+	std::string powerLeadingDigits(int exponent, size_t digitCount) const;
+
+	// Returns both of the above from a single run of the bounded exponentiation, for callers that need the two
+	std::pair<size_t, std::string> powerDigitCountAndLeadingDigits(int exponent, size_t digitCount) const;
+
+	// Returns this ^ exponent mod modulus in [0, modulus), keeping every intermediate below the modulus size.
+	// Throws std::invalid_argument for a negative exponent or a modulus that is not positive.
+	BigInt powMod(const BigInt& exponent, const BigInt& modulus) const;
+
 	// Operator override for multiplication
 	BigInt operator*(const BigInt& rhsOfMultiplyOperator) const;
+
+	// Operator override for negation
+	BigInt operator-() const&;
+	BigInt operator-() &&;
+
+	// Operator overrides for addition and subtraction, with carries and borrows propagated through the chunks.
+	// The in-place forms, and the forms with a temporary left-hand side, reuse the existing chunk vector when its
+	// capacity suffices.
+	BigInt operator+(const BigInt& rhsOfAddOperator) const&;
+	BigInt operator+(const BigInt& rhsOfAddOperator) &&;
+	BigInt operator-(const BigInt& rhsOfSubtractOperator) const&;
+	BigInt operator-(const BigInt& rhsOfSubtractOperator) &&;
+	BigInt& operator+=(const BigInt& rhsOfAddOperator);
+	BigInt& operator-=(const BigInt& rhsOfSubtractOperator);
+
+	// Operator overrides for division, truncating toward zero like the built-in integer types, so the remainder
+	// takes the sign of the dividend. divmod returns the quotient and the remainder from a single division.
+	// Dividing by zero throws std::invalid_argument.
+	BigInt operator/(const BigInt& rhsOfDivideOperator) const;
+	BigInt operator%(const BigInt& rhsOfModuloOperator) const;
+	std::pair<BigInt, BigInt> divmod(const BigInt& divisor) const;
+
+	// Operator overrides for comparison, by sign and then on the chunks from the most significant end. The remaining
+	// relational operators are derived from these two.
+	std::strong_ordering operator<=>(const BigInt& rhsOfCompareOperator) const;
+	bool operator==(const BigInt& rhsOfCompareOperator) const;
+
+	// Operator overrides for arithmetic with native integers, which run in linear time on the chunks
+	BigInt operator*(uint64_t factor) const&;
+	BigInt operator*(uint64_t factor) &&;
+	BigInt operator+(uint64_t addend) const&;
+	BigInt operator+(uint64_t addend) &&;
+	BigInt& operator*=(uint64_t factor);
+	BigInt& operator+=(uint64_t addend);
+
+	// Signed forms of the operators above, which apply the sign of the operand instead of wrapping it around to
+	// 2^64 - |operand|. Every signed integer type, plain int literals included, resolves to these.
+	BigInt& operator*=(int64_t factor);
+	BigInt& operator+=(int64_t addend);
+	template <std::signed_integral T> BigInt& operator*=(T factor) { return *this *= (int64_t)factor; }
+	template <std::signed_integral T> BigInt& operator+=(T addend) { return *this += (int64_t)addend; }
+	template <std::signed_integral T> BigInt operator*(T factor) const& { BigInt result = *this; result *= (int64_t)factor; return result; }
+	template <std::signed_integral T> BigInt operator*(T factor) && { *this *= (int64_t)factor; return std::move(*this); }
+	template <std::signed_integral T> BigInt operator+(T addend) const& { BigInt result = *this; result += (int64_t)addend; return result; }
+	template <std::signed_integral T> BigInt operator+(T addend) && { *this += (int64_t)addend; return std::move(*this); }
 };
\ No newline at end of file
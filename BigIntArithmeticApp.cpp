@@ -20,6 +20,10 @@
 *     took.
 *   - The app ensures input validity and continues prompting until a valid input is received.
 *   - The app continues to run until the user enters -1.
+*   - In last digit mode, only the last k digits of C are computed, as A ^ B mod 10^k, so no intermediate
+*     grows past k digits. In leading digit mode, the digit count and the first k digits of C come from
+*     a single call to BigInt::powerDigitCountAndLeadingDigits, which only works on bounds of a few
+*     more than k digits. The two modes can be combined.
 *
 ***************************************************************************************************/
 
@@ -28,6 +32,8 @@
 #include <iostream>
 #include <string>
 #include <chrono>
+#include <cmath>
+#include <stdexcept>
 
 void BigIntArithmeticApp::Run() {
     // Prompt the user to enter a number between 0 and 99999, then store it as a string
@@ -46,15 +52,43 @@ void BigIntArithmeticApp::Run() {
         BigInt A(numStrAndNumRevStr.first);
         int B = std::stoi(numStrAndNumRevStr.second);
 
-        // Perform C = A^B and time how long it takes
-        auto timeStart = std::chrono::high_resolution_clock::now();
-        BigInt C = A.powerOf(B);
-        auto timeStop = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(timeStop - timeStart);
+        if (lastDigitCount > 0 || leadingDigitCount > 0) {
+            // Compute only the requested digits of C = A^B, which is fast enough to be timed in microseconds
+            auto timeStart = std::chrono::high_resolution_clock::now();
+            size_t digitCount = 0;
+            std::string leadingDigits;
+            std::string lastDigits;
+            if (leadingDigitCount > 0) {
+                std::pair<size_t, std::string> digitCountAndLeadingDigits = A.powerDigitCountAndLeadingDigits(B, leadingDigitCount);
+                digitCount = digitCountAndLeadingDigits.first;
+                leadingDigits = digitCountAndLeadingDigits.second;
+            }
+            if (lastDigitCount > 0) {
+                lastDigits = GetLastDigitsOfPower(num, B, lastDigitCount);
+            }
+            auto timeStop = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(timeStop - timeStart);
 
-        // Print the results and the duration
-        std::cout << "Result: " << A.GetBigIntFullString() << " ^ " << B << ": " << std::endl << C.GetBigIntFullString() << std::endl;
-        std::cout << "This computation took " << duration.count() << " milliseconds to execute." << std::endl;
+            // Print the results and the duration
+            if (leadingDigitCount > 0) {
+                std::cout << "Result: " << A.GetBigIntFullString() << " ^ " << B << " has " << digitCount << " digits, the first " << leadingDigitCount << " of which are: " << std::endl << leadingDigits << std::endl;
+            }
+            if (lastDigitCount > 0) {
+                std::cout << "Result: last " << lastDigitCount << " digits of " << A.GetBigIntFullString() << " ^ " << B << ": " << std::endl << lastDigits << std::endl;
+            }
+            std::cout << "This computation took " << duration.count() << " microseconds to execute." << std::endl;
+        }
+        else {
+            // Perform C = A^B and time how long it takes
+            auto timeStart = std::chrono::high_resolution_clock::now();
+            BigInt C = A.powerOf(B);
+            auto timeStop = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(timeStop - timeStart);
+
+            // Print the results and the duration
+            std::cout << "Result: " << A.GetBigIntFullString() << " ^ " << B << ": " << std::endl << C.GetBigIntFullString() << std::endl;
+            std::cout << "This computation took " << duration.count() << " milliseconds to execute." << std::endl;
+        }
 
         // Prepare for the next iteration
         std::cout << "To exit, enter any negative number. Otherwise enter a number (0 - 99999): ";
@@ -80,4 +114,41 @@ std::pair<std::string, std::string> BigIntArithmeticApp::GetStrAndRevStrFromNum(
     std::string numRevStr = numStr;
     std::reverse(numRevStr.begin(), numRevStr.end());
     return { numStr, numRevStr };
+}
+
+std::string BigIntArithmeticApp::GetLastDigitsOfPower(int A, int B, size_t digitCount) {
+    if (digitCount == 0) {
+        throw std::invalid_argument("BigIntArithmeticApp: the number of last digits must be at least 1");
+    }
+
+    // A ^ B has at most B * log10(A) + 1 digits. Powers that may have no more than digitCount + 2 digits are cheap to
+    // compute in full, which settles whether the leading zeros of the last digits are part of A ^ B.
+    BigInt base(std::to_string(A));
+    if (A <= 1 || B * std::log10((double)A) <= digitCount + 1) {
+        std::string fullStr = base.powerOf(B).GetBigIntFullString();
+        return fullStr.size() > digitCount ? fullStr.substr(fullStr.size() - digitCount) : fullStr;
+    }
+
+    // Otherwise A ^ B has more than digitCount digits, and only its remainder by 10^digitCount is computed
+    BigInt modulus("1" + std::string(digitCount, '0'));
+    std::string lastDigits = base.powMod(BigInt(std::to_string(B)), modulus).GetBigIntFullString();
+    return std::string(digitCount - lastDigits.size(), '0') + lastDigits;
+}
+
+size_t BigIntArithmeticApp::ParseDigitCount(const std::string& countStr) {
+    // Digits are accumulated one at a time and checked against the limit, so no count can overflow
+    size_t count = 0;
+    for (char digit : countStr) {
+        if (digit < '0' || digit > '9') {
+            throw std::invalid_argument("BigIntArithmeticApp: the digit count must be a number");
+        }
+        count = count * 10 + (size_t)(digit - '0');
+        if (count > MAX_DIGIT_COUNT) {
+            break;
+        }
+    }
+    if (countStr.empty() || count == 0 || count > MAX_DIGIT_COUNT) {
+        throw std::invalid_argument("BigIntArithmeticApp: the digit count must be between 1 and " + std::to_string(MAX_DIGIT_COUNT));
+    }
+    return count;
 }
\ No newline at end of file
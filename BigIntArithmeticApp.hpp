@@ -13,6 +13,9 @@
 *   - The 'isValidInput' function ensures that the user inputs a number within the specified range.
 *   - 'GetStrAndRevStrFromNum' is an utility function that extracts the string representation of a number 
 *     and its reverse.
+*   - An app constructed with a last digit count only computes that many trailing digits of C, through
+*     'GetLastDigitsOfPower', which takes microseconds where the full result can take minutes. A leading
+*     digit count likewise reports the number of digits of C and its leading digits without computing it.
 *
 ***************************************************************************************************/
 
@@ -21,11 +24,32 @@
 
 class BigIntArithmeticApp {
 public:
-    BigIntArithmeticApp() {}
+    BigIntArithmeticApp() : lastDigitCount(0), leadingDigitCount(0) {}
+
+    // Only computes the last lastDigitCount and the leading leadingDigitCount decimal digits of each result,
+    // together with its digit count for the latter, or all of it when both are 0
+    BigIntArithmeticApp(size_t lastDigitCount, size_t leadingDigitCount = 0)
+        : lastDigitCount(lastDigitCount), leadingDigitCount(leadingDigitCount) {}
 
     void Run();
 
     bool isValidInput(int num);
 
     std::pair<std::string, std::string> GetStrAndRevStrFromNum(int num);
+
+    // Returns the last digitCount (at least 1) decimal digits of A ^ B, from A ^ B mod 10^digitCount. They are
+    // padded with leading zeros to digitCount digits unless A ^ B itself is shorter. Throws std::invalid_argument
+    // for a digitCount of 0.
+    std::string GetLastDigitsOfPower(int A, int B, size_t digitCount);
+
+    // Largest count accepted for the digit modes, about twice the length of 99999 ^ 99999
+    static constexpr size_t MAX_DIGIT_COUNT = 1000000;
+
+    // Parses the count given to --last-digits or --leading-digits, throwing std::invalid_argument unless it is a
+    // number from 1 to MAX_DIGIT_COUNT
+    static size_t ParseDigitCount(const std::string& countStr);
+
+private:
+    size_t lastDigitCount;
+    size_t leadingDigitCount;
 };
\ No newline at end of file
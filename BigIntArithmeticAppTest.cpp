@@ -6,8 +6,8 @@
 *
 * Module Description:
 *   This module focuses on testing the functionality of the BigIntArithmeticApp class. The test cases
-*   are built upon the Doctest framework and primarily concentrate on the validation of user inputs
-*   and the extraction of a number and its reverse as string representations.
+*   are built upon the Doctest framework and primarily concentrate on the validation of user inputs,
+*   the extraction of a number and its reverse as string representations and the last digit mode.
 *
 * Notes:
 *   - The module is a suite of test cases designed to validate the two methods in the BigIntArithmeticApp 
@@ -61,4 +61,37 @@ TEST_CASE("BigIntArithmeticApp GetStrAndRevStrFromNum stores and reverses input
     BigIntArithmeticApp app;
     REQUIRE(app.GetStrAndRevStrFromNum(num).first == "123");
     REQUIRE(app.GetStrAndRevStrFromNum(num).second == "321");
+}
+
+TEST_CASE("BigIntArithmeticApp GetLastDigitsOfPower matches the end of the full power...") {
+    BigIntArithmeticApp app;
+    std::string fullStr = BigInt("123").powerOf(321).GetBigIntFullString();
+    for (size_t digitCount : { 1, 9, 10, 50, 670 }) {
+        REQUIRE(app.GetLastDigitsOfPower(123, 321, digitCount) == fullStr.substr(fullStr.size() - digitCount));
+    }
+    REQUIRE(app.GetLastDigitsOfPower(123, 321, fullStr.size() + 5) == fullStr);
+}
+
+TEST_CASE("BigIntArithmeticApp GetLastDigitsOfPower keeps leading zeros only inside the power...") {
+    BigIntArithmeticApp app;
+    REQUIRE(app.GetLastDigitsOfPower(2, 10, 3) == "024");
+    REQUIRE(app.GetLastDigitsOfPower(2, 10, 6) == "1024");
+    REQUIRE(app.GetLastDigitsOfPower(10, 5, 3) == "000");
+    REQUIRE(app.GetLastDigitsOfPower(0, 0, 4) == "1");
+    REQUIRE(app.GetLastDigitsOfPower(0, 7, 4) == "0");
+    REQUIRE(app.GetLastDigitsOfPower(99999, 99999, 10) == "9999899999");
+    REQUIRE(app.GetLastDigitsOfPower(12345, 54321, 30) == "828558580018579959869384765625");
+}
+
+TEST_CASE("BigIntArithmeticApp rejects digit counts of 0 and out of range...") {
+    BigIntArithmeticApp app;
+    REQUIRE_THROWS_AS(app.GetLastDigitsOfPower(123, 321, 0), std::invalid_argument);
+    REQUIRE(BigIntArithmeticApp::ParseDigitCount("20") == 20);
+    REQUIRE(BigIntArithmeticApp::ParseDigitCount(std::to_string(BigIntArithmeticApp::MAX_DIGIT_COUNT)) == BigIntArithmeticApp::MAX_DIGIT_COUNT);
+    REQUIRE_THROWS_AS(BigIntArithmeticApp::ParseDigitCount("0"), std::invalid_argument);
+    REQUIRE_THROWS_AS(BigIntArithmeticApp::ParseDigitCount("000"), std::invalid_argument);
+    REQUIRE_THROWS_AS(BigIntArithmeticApp::ParseDigitCount(""), std::invalid_argument);
+    REQUIRE_THROWS_AS(BigIntArithmeticApp::ParseDigitCount("12a"), std::invalid_argument);
+    REQUIRE_THROWS_AS(BigIntArithmeticApp::ParseDigitCount("99999999999999999999999999"), std::invalid_argument);
+    REQUIRE_THROWS_AS(BigIntArithmeticApp::ParseDigitCount(std::to_string(BigIntArithmeticApp::MAX_DIGIT_COUNT + 1)), std::invalid_argument);
 }
\ No newline at end of file
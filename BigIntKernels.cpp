@@ -0,0 +1,1745 @@
+/***************************************************************************************************
+* Module Name: BigInt Arithmetic Kernels Implementation
+*
+* Date: October, 2026
+*
+* Module Description:
+*	This module contains the low-level limb routines behind BigInt multiplication. It provides
+*	carry-propagating addition and subtraction on chunk buffers, a little-endian schoolbook
+*	multiplication used as the base case, and a Karatsuba multiplication that recursively splits
+*	its operands until they fall below the configured threshold.
+*
+* Notes:
+*   - Karatsuba replaces the four half-size products of the schoolbook method with three, which
+*	  brings the cost down from O(n^2) to O(n^1.585).
+*   - Operands of very different sizes are cut into pieces of the shorter operand's size, since
+*	  splitting both operands at the same point only pays off when they are roughly balanced.
+*   - Decimal strings are parsed chunk by chunk in decimal mode. In binary mode the digits are split in
+*	  halves recursively around cached powers 10^(19 * 2^k), so that parsing costs a few large
+*	  multiplications instead of one pass over the chunks per group of digits.
+*   - On hosts with AVX2 (decimal mode) or AVX-512 IFMA (binary mode) the schoolbook kernels hand their
+*	  operands to the vectorized kernel of BigIntSimd once they are SIMD_MIN_MULTIPLY_CHUNKS long.
+*   - The largest operands are multiplied with a number-theoretic transform, which is an FFT over
+*	  the integers modulo a prime. Three primes are used and the results are recombined with the
+*	  Chinese Remainder Theorem, so the product is exact without any floating point rounding.
+*
+***************************************************************************************************/
+
+#include "BigIntKernels.hpp"
+#include "BigIntSimd.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+namespace BigIntKernels {
+
+// Helper functions for adding and subtracting little-endian chunk buffers
+LimbVector Add(const Limb* a, size_t aSize, const Limb* b, size_t bSize) {
+    if (aSize < bSize) {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+    LimbVector result(aSize + 1, 0);
+    WideLimb carry = 0;
+    for (size_t i = 0; i < aSize; i++) {
+        carry += (WideLimb)a[i] + (i < bSize ? b[i] : 0);
+        result[i] = (Limb)(carry % LIMB_BASE);
+        carry /= LIMB_BASE;
+    }
+    result[aSize] = (Limb)carry;
+    return result;
+}
+
+// Subtracts b from a, where the value of a must be at least the value of b. Chunks of b beyond the
+// size of a must be zero.
+void SubtractInPlace(Limb* a, size_t aSize, const Limb* b, size_t bSize) {
+    Limb borrow = 0;
+    size_t commonSize = std::min(aSize, bSize);
+    size_t i = 0;
+    for (; i < commonSize; i++) {
+        // Adding LIMB_BASE up front keeps the difference non-negative, and the borrow is whether it was needed
+        WideLimb diff = (WideLimb)a[i] + LIMB_BASE - b[i] - borrow;
+        a[i] = (Limb)(diff % LIMB_BASE);
+        borrow = (diff < LIMB_BASE) ? 1 : 0;
+    }
+    for (; borrow != 0 && i < aSize; i++) {
+        borrow = (a[i] == 0) ? 1 : 0;
+        a[i] = (Limb)(((WideLimb)a[i] + LIMB_BASE - 1) % LIMB_BASE);
+    }
+}
+
+void SubtractInPlace(LimbVector& a, const LimbVector& b) {
+    SubtractInPlace(a.data(), a.size(), b.data(), b.size());
+}
+
+// Adds b into a, where a has at least as many chunks as b, and returns the carry out of the top chunk of a
+Limb AddInPlace(Limb* a, size_t aSize, const Limb* b, size_t bSize) {
+    WideLimb carry = 0;
+    size_t i = 0;
+    for (; i < bSize; i++) {
+        carry += (WideLimb)a[i] + b[i];
+        a[i] = (Limb)(carry % LIMB_BASE);
+        carry /= LIMB_BASE;
+    }
+    for (; carry != 0 && i < aSize; i++) {
+        carry += a[i];
+        a[i] = (Limb)(carry % LIMB_BASE);
+        carry /= LIMB_BASE;
+    }
+    return (Limb)carry;
+}
+
+// Adds x * LIMB_BASE^shift into acc. Chunks that would land beyond the end of acc must be zero.
+void AddShiftedInPlace(LimbVector& acc, const LimbVector& x, size_t shift) {
+    AddShiftedInPlace(acc.data(), acc.size(), x, shift);
+}
+
+void AddShiftedInPlace(Limb* acc, size_t accSize, const LimbVector& x, size_t shift) {
+    WideLimb carry = 0;
+    size_t i = 0;
+    for (; i < x.size() && shift + i < accSize; i++) {
+        carry += (WideLimb)acc[shift + i] + x[i];
+        acc[shift + i] = (Limb)(carry % LIMB_BASE);
+        carry /= LIMB_BASE;
+    }
+    for (size_t k = shift + i; carry != 0 && k < accSize; k++) {
+        carry += acc[k];
+        acc[k] = (Limb)(carry % LIMB_BASE);
+        carry /= LIMB_BASE;
+    }
+}
+
+int Compare(const Limb* a, size_t aSize, const Limb* b, size_t bSize) {
+    while (aSize > 0 && a[aSize - 1] == 0) {
+        aSize--;
+    }
+    while (bSize > 0 && b[bSize - 1] == 0) {
+        bSize--;
+    }
+    if (aSize != bSize) {
+        return (aSize < bSize) ? -1 : 1;
+    }
+    for (size_t i = aSize; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return (a[i] < b[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Word-sized helpers used to convert between decimal strings and binary chunks
+Limb MultiplyAddWordInPlace(Limb* num, size_t numSize, Limb factor, Limb addend) {
+    WideLimb carry = addend;
+    for (size_t i = 0; i < numSize; i++) {
+        carry += (WideLimb)num[i] * factor;
+        num[i] = (Limb)(carry % LIMB_BASE);
+        carry /= LIMB_BASE;
+    }
+    return (Limb)carry;
+}
+
+void MultiplyAddWordInPlace(LimbVector& num, Limb factor, Limb addend) {
+    Limb carry = MultiplyAddWordInPlace(num.data(), num.size(), factor, addend);
+    if (carry != 0) {
+        num.push_back(carry);
+    }
+}
+
+size_t ChunksFromWord(uint64_t value, Limb* chunks) {
+    size_t chunkCount = 0;
+    while (value != 0) {
+        chunks[chunkCount++] = (Limb)(value % LIMB_BASE);
+        value = (uint64_t)(value / LIMB_BASE);
+    }
+    return chunkCount;
+}
+
+LimbVector ChunksFromWord(uint64_t value) {
+    Limb chunks[MAX_WORD_CHUNKS];
+    return LimbVector(chunks, chunks + ChunksFromWord(value, chunks));
+}
+
+Limb DivideByWordInPlace(Limb* num, size_t numSize, Limb divisor) {
+    WideLimb remainder = 0;
+    for (size_t i = numSize; i-- > 0;) {
+        WideLimb cur = remainder * LIMB_BASE + num[i];
+        num[i] = (Limb)(cur / divisor);
+        remainder = cur % divisor;
+    }
+    return (Limb)remainder;
+}
+
+Limb DivideByWordInPlace(LimbVector& num, Limb divisor) {
+    Limb remainder = DivideByWordInPlace(num.data(), num.size(), divisor);
+    while (!num.empty() && num.back() == 0) {
+        num.pop_back();
+    }
+    return remainder;
+}
+
+uint64_t ParseDecimalWord(const char* digits, size_t numDigits) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < numDigits; i++) {
+        if (digits[i] < '0' || digits[i] > '9') {
+            throw std::invalid_argument("BigInt: invalid decimal digit in input string");
+        }
+        value = value * 10 + (uint64_t)(digits[i] - '0');
+    }
+    return value;
+}
+
+// Multiplication kernels
+namespace {
+    /* The schoolbook kernels work column by column: the chunk products a[i] * b[k - i] of column k are summed
+    *  before anything is written, and the sum is then split into one result chunk and the carry into the next
+    *  column. A ColumnSum holds the running sum of a column.
+    *   - In decimal mode a product is below 10^18, so PRODUCTS_PER_FLUSH of them fit in 64 bits on top of the
+    *     carry into a column, which stays below 10^18 for operands shorter than 10^9 chunks. The sum is kept
+    *     as high * LIMB_BASE + low, and low is only divided by the base once per PRODUCTS_PER_FLUSH products.
+    *   - In binary mode the sum is kept in 128 bits plus a word counting how often they overflowed, and is
+    *     never divided at all.
+    */
+#ifdef BIGINT_BINARY_LIMBS
+    const size_t PRODUCTS_PER_FLUSH = SIZE_MAX;
+    // Below these sizes converting to 52-bit digits costs more than IFMA saves. SimdMultiply does every product
+    // of a square, so it only beats SchoolbookSquareTo for longer operands.
+    const size_t SIMD_MIN_MULTIPLY_CHUNKS = 16;
+    const size_t SIMD_MIN_SQUARE_CHUNKS = 32;
+
+    struct ColumnSum {
+        WideLimb low = 0;
+        Limb overflow = 0;
+
+        // Adds a[i] * bReversed[-i] for i below count
+        void AddProducts(const Limb* a, const Limb* bReversed, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                WideLimb product = (WideLimb)a[i] * *(bReversed - i);
+                low += product;
+                overflow += (low < product) ? 1 : 0;
+            }
+        }
+
+        void AddWord(WideLimb word) {
+            low += word;
+            overflow += (low < word) ? 1 : 0;
+        }
+
+        void Double() {
+            overflow = 2 * overflow + (Limb)(low >> 127);
+            low <<= 1;
+        }
+
+        void Flush() {}
+
+        // Returns the chunk of the column and sets the carry into the next one
+        Limb TakeChunk(WideLimb& carry) {
+            carry = (low >> 64) | ((WideLimb)overflow << 64);
+            return (Limb)low;
+        }
+    };
+#else
+    const size_t PRODUCTS_PER_FLUSH = 17;
+    // Below these sizes a vector holds too few products to make up for carrying the columns afterwards
+    const size_t SIMD_MIN_MULTIPLY_CHUNKS = 8;
+    const size_t SIMD_MIN_SQUARE_CHUNKS = 12;
+
+    struct ColumnSum {
+        WideLimb low = 0;
+        WideLimb high = 0;
+
+        void AddProducts(const Limb* a, const Limb* bReversed, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                low += (WideLimb)a[i] * *(bReversed - i);
+            }
+        }
+
+        void AddWord(WideLimb word) {
+            low += word;
+        }
+
+        // Only called right after a flush, when low is below LIMB_BASE
+        void Double() {
+            low *= 2;
+            high *= 2;
+        }
+
+        void Flush() {
+            high += low / LIMB_BASE;
+            low %= LIMB_BASE;
+        }
+
+        Limb TakeChunk(WideLimb& carry) {
+            Flush();
+            carry = high;
+            return (Limb)low;
+        }
+    };
+#endif
+
+    // Adds a[i] * bReversed[-i] for i below count to column, flushing it once per PRODUCTS_PER_FLUSH products
+    void AddColumnProducts(ColumnSum& column, const Limb* a, const Limb* bReversed, size_t count) {
+        for (size_t done = 0; done < count;) {
+            size_t block = std::min(count - done, PRODUCTS_PER_FLUSH);
+            column.AddProducts(a + done, bReversed - done, block);
+            column.Flush();
+            done += block;
+        }
+    }
+
+    // Schoolbook kernels writing into a caller-owned buffer of aSize + bSize (2 * aSize for squaring) chunks
+    void SchoolbookMultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result) {
+        if (aSize == 0 || bSize == 0) {
+            std::fill(result, result + aSize + bSize, 0);
+            return;
+        }
+        if (std::min(aSize, bSize) >= SIMD_MIN_MULTIPLY_CHUNKS && SimdMultiply(a, aSize, b, bSize, result)) {
+            return;
+        }
+        WideLimb carry = 0;
+        for (size_t k = 0; k + 1 < aSize + bSize; k++) {
+            size_t iStart = (k < bSize) ? 0 : k - bSize + 1;
+            size_t iEnd = std::min(k + 1, aSize);
+            ColumnSum column;
+            column.AddWord(carry);
+            AddColumnProducts(column, a + iStart, b + (k - iStart), iEnd - iStart);
+            result[k] = column.TakeChunk(carry);
+        }
+        result[aSize + bSize - 1] = (Limb)carry;
+    }
+
+    // Squaring only sums the cross products a[i] * a[j] with i < j of each column, which are doubled before the
+    // square a[i] * a[i] on the diagonal is added, so it does about half the chunk products of SchoolbookMultiply
+    void SchoolbookSquareTo(const Limb* a, size_t aSize, Limb* result) {
+        if (aSize == 0) {
+            return;
+        }
+        if (aSize >= SIMD_MIN_SQUARE_CHUNKS && SimdMultiply(a, aSize, a, aSize, result)) {
+            return;
+        }
+        WideLimb carry = 0;
+        for (size_t k = 0; k + 1 < 2 * aSize; k++) {
+            size_t iStart = (k < aSize) ? 0 : k - aSize + 1;
+            size_t iEnd = (k + 1) / 2;
+            ColumnSum column;
+            if (iEnd > iStart) {
+                AddColumnProducts(column, a + iStart, a + (k - iStart), iEnd - iStart);
+            }
+            column.Double();
+            if (k % 2 == 0) {
+                column.AddWord((WideLimb)a[k / 2] * a[k / 2]);
+            }
+            column.AddWord(carry);
+            result[k] = column.TakeChunk(carry);
+        }
+        result[2 * aSize - 1] = (Limb)carry;
+    }
+}
+
+LimbVector SchoolbookMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize) {
+    LimbVector result(aSize + bSize);
+    SchoolbookMultiplyTo(a, aSize, b, bSize, result.data());
+    return result;
+}
+
+LimbVector SchoolbookSquare(const Limb* a, size_t aSize) {
+    LimbVector result(2 * aSize);
+    SchoolbookSquareTo(a, aSize, result.data());
+    return result;
+}
+
+namespace {
+    // Forms of the recursive kernels that write their whole product to a caller-owned buffer, defined with the
+    // kernels below, so that the dispatchers can pass their output buffer straight down to whichever tier runs
+    void KaratsubaMultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result, const MultiplyConfig& config);
+    void KaratsubaSquareTo(const Limb* a, size_t aSize, Limb* result, const MultiplyConfig& config);
+    void ToomCook3MultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result, const MultiplyConfig& config);
+    void ToomCook3SquareTo(const Limb* a, size_t aSize, Limb* result, const MultiplyConfig& config);
+    void ToomCook4MultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result, const MultiplyConfig& config);
+    void ToomCook4SquareTo(const Limb* a, size_t aSize, Limb* result, const MultiplyConfig& config);
+    void NttMultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result);
+}
+
+// Multiplication dispatcher, picks the algorithm tier from the size of the shorter operand
+void MultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* out, const MultiplyConfig& config) {
+    if (aSize < bSize) {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+    // The transform handles unbalanced operands directly, so it is checked before slicing
+    if (bSize >= config.nttThreshold && aSize + bSize <= NTT_MAX_SIZE) {
+        NttMultiplyTo(a, aSize, b, bSize, out);
+        return;
+    }
+    // Below four chunks the sums a0 + a1 are no shorter than the operands, so the recursion would not shrink
+    if (bSize < std::max<size_t>(config.karatsubaThreshold, 4)) {
+        SchoolbookMultiplyTo(a, aSize, b, bSize, out);
+        return;
+    }
+
+    // Unbalanced operands: multiply b by consecutive slices of a that are as long as b
+    if (2 * bSize <= aSize) {
+        std::fill(out, out + aSize + bSize, 0);
+        for (size_t offset = 0; offset < aSize; offset += bSize) {
+            size_t sliceSize = std::min(bSize, aSize - offset);
+            LimbVector partial = Multiply(a + offset, sliceSize, b, bSize, config);
+            AddShiftedInPlace(out, aSize + bSize, partial, offset);
+        }
+        return;
+    }
+
+    if (bSize >= std::max<size_t>(config.toom4Threshold, 16)) {
+        ToomCook4MultiplyTo(a, aSize, b, bSize, out, config);
+    }
+    else if (bSize >= std::max<size_t>(config.toom3Threshold, 9)) {
+        ToomCook3MultiplyTo(a, aSize, b, bSize, out, config);
+    }
+    else {
+        KaratsubaMultiplyTo(a, aSize, b, bSize, out, config);
+    }
+}
+
+// Squaring dispatcher, uses the same thresholds as the multiplication dispatcher
+void SquareTo(const Limb* a, size_t aSize, Limb* out, const MultiplyConfig& config) {
+    if (aSize >= config.nttThreshold && 2 * aSize <= NTT_MAX_SIZE) {
+        NttMultiplyTo(a, aSize, a, aSize, out);
+    }
+    else if (aSize < std::max<size_t>(config.karatsubaThreshold, 4)) {
+        SchoolbookSquareTo(a, aSize, out);
+    }
+    else if (aSize >= std::max<size_t>(config.toom4Threshold, 16)) {
+        ToomCook4SquareTo(a, aSize, out, config);
+    }
+    else if (aSize >= std::max<size_t>(config.toom3Threshold, 9)) {
+        ToomCook3SquareTo(a, aSize, out, config);
+    }
+    else {
+        KaratsubaSquareTo(a, aSize, out, config);
+    }
+}
+
+LimbVector Multiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config) {
+    LimbVector result(aSize + bSize);
+    MultiplyTo(a, aSize, b, bSize, result.data(), config);
+    return result;
+}
+
+LimbVector Square(const Limb* a, size_t aSize, const MultiplyConfig& config) {
+    LimbVector result(2 * aSize);
+    SquareTo(a, aSize, result.data(), config);
+    return result;
+}
+
+void MultiplyInto(const Limb* a, size_t aSize, const Limb* b, size_t bSize, LimbVector& out, const MultiplyConfig& config) {
+    out.resize(aSize + bSize);
+    MultiplyTo(a, aSize, b, bSize, out.data(), config);
+}
+
+void SquareInto(const Limb* a, size_t aSize, LimbVector& out, const MultiplyConfig& config) {
+    out.resize(2 * aSize);
+    SquareTo(a, aSize, out.data(), config);
+}
+
+/* Karatsuba Multiplication Algorithm Overview:
+*   - Both operands are split at h chunks, giving a = a1 * base^h + a0 and b = b1 * base^h + b0.
+*   - The product is z2 * base^2h + z1 * base^h + z0 where z0 = a0 * b0, z2 = a1 * b1, and the middle
+*     term is recovered from a single product as z1 = (a0 + a1) * (b0 + b1) - z0 - z2.
+*/
+namespace {
+    // The low product z0 fills the bottom 2h chunks of the result and z2 the rest, so only z1 has to be added
+    void KaratsubaMultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result, const MultiplyConfig& config) {
+        // Split point, chosen so that the high part of the shorter operand is never empty
+        size_t h = aSize / 2;
+        LimbVector z0 = Multiply(a, h, b, h, config);
+        LimbVector z2 = Multiply(a + h, aSize - h, b + h, bSize - h, config);
+
+        LimbVector aSum = Add(a, h, a + h, aSize - h);
+        LimbVector bSum = Add(b, h, b + h, bSize - h);
+        LimbVector z1 = Multiply(aSum.data(), aSum.size(), bSum.data(), bSum.size(), config);
+        SubtractInPlace(z1, z0);
+        SubtractInPlace(z1, z2);
+
+        std::copy(z0.begin(), z0.end(), result);
+        std::copy(z2.begin(), z2.end(), result + 2 * h);
+        AddShiftedInPlace(result, aSize + bSize, z1, h);
+    }
+
+    // Karatsuba squaring, where all three half-size products are themselves squares
+    void KaratsubaSquareTo(const Limb* a, size_t aSize, Limb* result, const MultiplyConfig& config) {
+        size_t h = aSize / 2;
+        LimbVector z0 = Square(a, h, config);
+        LimbVector z2 = Square(a + h, aSize - h, config);
+
+        LimbVector aSum = Add(a, h, a + h, aSize - h);
+        LimbVector z1 = Square(aSum.data(), aSum.size(), config);
+        SubtractInPlace(z1, z0);
+        SubtractInPlace(z1, z2);
+
+        std::copy(z0.begin(), z0.end(), result);
+        std::copy(z2.begin(), z2.end(), result + 2 * h);
+        AddShiftedInPlace(result, 2 * aSize, z1, h);
+    }
+}
+
+LimbVector KaratsubaMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config) {
+    LimbVector result(aSize + bSize);
+    KaratsubaMultiplyTo(a, aSize, b, bSize, result.data(), config);
+    return result;
+}
+
+LimbVector KaratsubaSquare(const Limb* a, size_t aSize, const MultiplyConfig& config) {
+    LimbVector result(2 * aSize);
+    KaratsubaSquareTo(a, aSize, result.data(), config);
+    return result;
+}
+
+/* Toom-Cook Multiplication Algorithm Overview:
+*   - Each operand is split into k pieces of h chunks and read as a polynomial in x = base^h, so that
+*     a = a(base^h) and b = b(base^h). The product polynomial r(x) = a(x) * b(x) has 2k - 1 coefficients.
+*   - Both polynomials are evaluated at 2k - 1 points, the evaluations are multiplied pairwise (these are
+*     the only recursive products, 2k - 1 of them instead of k^2), and the coefficients of r are recovered
+*     by interpolation. Toom-3 uses the points 0, 1, -1, 2 and infinity, and Toom-4 adds -2 and 3.
+*   - Evaluations at negative points can be negative, so the intermediate values carry a sign. Every
+*     division in the interpolation is exact.
+*   - When squaring, each point is evaluated once and the pointwise products are squares.
+*/
+namespace {
+    // Sign-magnitude value used for the evaluations and interpolation of the Toom-Cook algorithms.
+    // The magnitude is kept without zero chunks at its most significant end, so zero is an empty vector.
+    struct SignedValue {
+        LimbVector magnitude;
+        bool isNegative;
+    };
+    typedef std::vector<SignedValue, ScratchAllocator<SignedValue>> SignedValueVector;
+
+    void Trim(LimbVector& num) {
+        while (!num.empty() && num.back() == 0) {
+            num.pop_back();
+        }
+    }
+
+    int CompareMagnitude(const LimbVector& a, const LimbVector& b) {
+        return Compare(a.data(), a.size(), b.data(), b.size());
+    }
+
+    SignedValue MakeSigned(const Limb* num, size_t numSize) {
+        SignedValue value = { LimbVector(num, num + numSize), false };
+        Trim(value.magnitude);
+        return value;
+    }
+
+    SignedValue SignedAdd(const SignedValue& x, const SignedValue& y) {
+        SignedValue sum;
+        if (x.isNegative == y.isNegative) {
+            sum.magnitude = Add(x.magnitude.data(), x.magnitude.size(), y.magnitude.data(), y.magnitude.size());
+            sum.isNegative = x.isNegative;
+        }
+        else if (CompareMagnitude(x.magnitude, y.magnitude) >= 0) {
+            sum.magnitude = x.magnitude;
+            SubtractInPlace(sum.magnitude, y.magnitude);
+            sum.isNegative = x.isNegative;
+        }
+        else {
+            sum.magnitude = y.magnitude;
+            SubtractInPlace(sum.magnitude, x.magnitude);
+            sum.isNegative = y.isNegative;
+        }
+        Trim(sum.magnitude);
+        sum.isNegative = sum.isNegative && !sum.magnitude.empty();
+        return sum;
+    }
+
+    SignedValue SignedSubtract(const SignedValue& x, const SignedValue& y) {
+        SignedValue negatedY = { y.magnitude, !y.isNegative && !y.magnitude.empty() };
+        return SignedAdd(x, negatedY);
+    }
+
+    // Multiplies by a small signed factor, whose magnitude times the base must fit in a WideLimb
+    SignedValue SignedScale(const SignedValue& x, int factor) {
+        SignedValue scaled = { LimbVector(x.magnitude.size() + 1, 0), (x.isNegative != (factor < 0)) };
+        WideLimb absFactor = (WideLimb)((factor < 0) ? -factor : factor);
+        WideLimb carry = 0;
+        for (size_t i = 0; i < x.magnitude.size(); i++) {
+            WideLimb cur = x.magnitude[i] * absFactor + carry;
+            scaled.magnitude[i] = (Limb)(cur % LIMB_BASE);
+            carry = cur / LIMB_BASE;
+        }
+        scaled.magnitude[x.magnitude.size()] = (Limb)carry;
+        Trim(scaled.magnitude);
+        scaled.isNegative = scaled.isNegative && !scaled.magnitude.empty();
+        return scaled;
+    }
+
+    // Divides by a small positive divisor that is known to divide the value exactly
+    SignedValue SignedDivideExact(const SignedValue& x, Limb divisor) {
+        SignedValue quotient = x;
+        WideLimb remainder = 0;
+        for (size_t i = quotient.magnitude.size(); i-- > 0;) {
+            WideLimb cur = remainder * LIMB_BASE + quotient.magnitude[i];
+            quotient.magnitude[i] = (Limb)(cur / divisor);
+            remainder = cur % divisor;
+        }
+        Trim(quotient.magnitude);
+        return quotient;
+    }
+
+    SignedValue SignedMultiply(const SignedValue& x, const SignedValue& y, const MultiplyConfig& config) {
+        SignedValue product = { Multiply(x.magnitude.data(), x.magnitude.size(), y.magnitude.data(), y.magnitude.size(), config),
+            x.isNegative != y.isNegative };
+        Trim(product.magnitude);
+        product.isNegative = product.isNegative && !product.magnitude.empty();
+        return product;
+    }
+
+    SignedValue SignedSquare(const SignedValue& x, const MultiplyConfig& config) {
+        SignedValue product = { Square(x.magnitude.data(), x.magnitude.size(), config), false };
+        Trim(product.magnitude);
+        return product;
+    }
+
+    // Splits num into numPieces pieces of pieceSize chunks, the last ones possibly shorter or empty
+    SignedValueVector SplitIntoPieces(const Limb* num, size_t numSize, size_t numPieces, size_t pieceSize) {
+        SignedValueVector pieces;
+        for (size_t i = 0; i < numPieces; i++) {
+            size_t start = std::min(i * pieceSize, numSize);
+            size_t end = std::min(start + pieceSize, numSize);
+            pieces.push_back(MakeSigned(num + start, end - start));
+        }
+        return pieces;
+    }
+
+    // Evaluates the polynomial with the given coefficients at a small integer point using Horner's rule
+    SignedValue Evaluate(const SignedValueVector& pieces, int point) {
+        SignedValue value = pieces.back();
+        for (size_t i = pieces.size() - 1; i-- > 0;) {
+            value = SignedAdd(SignedScale(value, point), pieces[i]);
+        }
+        return value;
+    }
+
+    // Sums the non-negative interpolated coefficients into a product buffer of resultSize chunks
+    void Recompose(const SignedValueVector& coefficients, size_t pieceSize, Limb* result, size_t resultSize) {
+        std::fill(result, result + resultSize, 0);
+        for (size_t i = 0; i < coefficients.size(); i++) {
+            AddShiftedInPlace(result, resultSize, coefficients[i].magnitude, i * pieceSize);
+        }
+    }
+
+    // Toom-3 interpolation from the pointwise products r(0), r(1), r(-1), r(2) and r(infinity)
+    void ToomCook3Interpolate(const SignedValueVector& r, size_t h, Limb* result, size_t resultSize) {
+        const SignedValue& r0 = r[0];
+        const SignedValue& r1 = r[1];
+        const SignedValue& rMinus1 = r[2];
+        const SignedValue& r2 = r[3];
+        const SignedValue& rInf = r[4];
+
+        // The even and odd parts at +-1 give c0 + c2 + c4 and c1 + c3, and the point 2 separates c1 from c3
+        SignedValueVector c(5);
+        c[0] = r0;
+        c[4] = rInf;
+        SignedValue even1 = SignedDivideExact(SignedAdd(r1, rMinus1), 2);
+        SignedValue odd1 = SignedDivideExact(SignedSubtract(r1, rMinus1), 2);
+        c[2] = SignedSubtract(SignedSubtract(even1, c[0]), c[4]);
+        // (r(2) - c0 - 4 * c2 - 16 * c4) / 2 = c1 + 4 * c3
+        SignedValue odd2 = SignedSubtract(r2, c[0]);
+        odd2 = SignedSubtract(odd2, SignedScale(c[2], 4));
+        odd2 = SignedSubtract(odd2, SignedScale(c[4], 16));
+        odd2 = SignedDivideExact(odd2, 2);
+        c[3] = SignedDivideExact(SignedSubtract(odd2, odd1), 3);
+        c[1] = SignedSubtract(odd1, c[3]);
+
+        Recompose(c, h, result, resultSize);
+    }
+
+    // Toom-4 interpolation from the pointwise products r(0), r(1), r(-1), r(2), r(-2), r(3) and r(infinity)
+    void ToomCook4Interpolate(const SignedValueVector& r, size_t h, Limb* result, size_t resultSize) {
+        const SignedValue& r0 = r[0];
+        const SignedValue& r1 = r[1];
+        const SignedValue& rMinus1 = r[2];
+        const SignedValue& r2 = r[3];
+        const SignedValue& rMinus2 = r[4];
+        const SignedValue& r3 = r[5];
+        const SignedValue& rInf = r[6];
+
+        SignedValueVector c(7);
+        c[0] = r0;
+        c[6] = rInf;
+
+        // Even coefficients: (r(1) + r(-1)) / 2 - c0 - c6 = c2 + c4 and (r(2) + r(-2)) / 2 - c0 - 64 * c6 = 4 * (c2 + 4 * c4)
+        SignedValue even1 = SignedDivideExact(SignedAdd(r1, rMinus1), 2);
+        even1 = SignedSubtract(SignedSubtract(even1, c[0]), c[6]);
+        SignedValue even2 = SignedDivideExact(SignedAdd(r2, rMinus2), 2);
+        even2 = SignedSubtract(SignedSubtract(even2, c[0]), SignedScale(c[6], 64));
+        even2 = SignedDivideExact(even2, 4);
+        c[4] = SignedDivideExact(SignedSubtract(even2, even1), 3);
+        c[2] = SignedSubtract(even1, c[4]);
+
+        // Odd coefficients: the points 1, 2 and 3 give c1 + c3 + c5, c1 + 4 * c3 + 16 * c5 and c1 + 9 * c3 + 81 * c5
+        SignedValue odd1 = SignedDivideExact(SignedSubtract(r1, rMinus1), 2);
+        SignedValue odd2 = SignedDivideExact(SignedSubtract(r2, rMinus2), 4);
+        SignedValue odd3 = SignedSubtract(r3, c[0]);
+        odd3 = SignedSubtract(odd3, SignedScale(c[2], 9));
+        odd3 = SignedSubtract(odd3, SignedScale(c[4], 81));
+        odd3 = SignedSubtract(odd3, SignedScale(c[6], 729));
+        odd3 = SignedDivideExact(odd3, 3);
+        // (odd2 - odd1) / 3 = c3 + 5 * c5 and (odd3 - odd2) / 5 = c3 + 13 * c5
+        SignedValue diff1 = SignedDivideExact(SignedSubtract(odd2, odd1), 3);
+        SignedValue diff2 = SignedDivideExact(SignedSubtract(odd3, odd2), 5);
+        c[5] = SignedDivideExact(SignedSubtract(diff2, diff1), 8);
+        c[3] = SignedSubtract(diff1, SignedScale(c[5], 5));
+        c[1] = SignedSubtract(SignedSubtract(odd1, c[3]), c[5]);
+
+        Recompose(c, h, result, resultSize);
+    }
+
+    // Evaluation points shared by the Toom-3 and Toom-4 products, in the order the interpolations expect.
+    // The point at infinity is the leading piece and is handled separately.
+    const int TOOM3_POINTS[] = { 0, 1, -1, 2 };
+    const int TOOM4_POINTS[] = { 0, 1, -1, 2, -2, 3 };
+
+    void ToomCook3MultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result, const MultiplyConfig& config) {
+        size_t h = (aSize + 2) / 3;
+        SignedValueVector aPieces = SplitIntoPieces(a, aSize, 3, h);
+        SignedValueVector bPieces = SplitIntoPieces(b, bSize, 3, h);
+
+        SignedValueVector r;
+        for (int point : TOOM3_POINTS) {
+            r.push_back(SignedMultiply(Evaluate(aPieces, point), Evaluate(bPieces, point), config));
+        }
+        r.push_back(SignedMultiply(aPieces[2], bPieces[2], config));
+        ToomCook3Interpolate(r, h, result, aSize + bSize);
+    }
+
+    void ToomCook3SquareTo(const Limb* a, size_t aSize, Limb* result, const MultiplyConfig& config) {
+        size_t h = (aSize + 2) / 3;
+        SignedValueVector aPieces = SplitIntoPieces(a, aSize, 3, h);
+
+        SignedValueVector r;
+        for (int point : TOOM3_POINTS) {
+            r.push_back(SignedSquare(Evaluate(aPieces, point), config));
+        }
+        r.push_back(SignedSquare(aPieces[2], config));
+        ToomCook3Interpolate(r, h, result, 2 * aSize);
+    }
+
+    void ToomCook4MultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result, const MultiplyConfig& config) {
+        size_t h = (aSize + 3) / 4;
+        SignedValueVector aPieces = SplitIntoPieces(a, aSize, 4, h);
+        SignedValueVector bPieces = SplitIntoPieces(b, bSize, 4, h);
+
+        SignedValueVector r;
+        for (int point : TOOM4_POINTS) {
+            r.push_back(SignedMultiply(Evaluate(aPieces, point), Evaluate(bPieces, point), config));
+        }
+        r.push_back(SignedMultiply(aPieces[3], bPieces[3], config));
+        ToomCook4Interpolate(r, h, result, aSize + bSize);
+    }
+
+    void ToomCook4SquareTo(const Limb* a, size_t aSize, Limb* result, const MultiplyConfig& config) {
+        size_t h = (aSize + 3) / 4;
+        SignedValueVector aPieces = SplitIntoPieces(a, aSize, 4, h);
+
+        SignedValueVector r;
+        for (int point : TOOM4_POINTS) {
+            r.push_back(SignedSquare(Evaluate(aPieces, point), config));
+        }
+        r.push_back(SignedSquare(aPieces[3], config));
+        ToomCook4Interpolate(r, h, result, 2 * aSize);
+    }
+}
+
+LimbVector ToomCook3Multiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config) {
+    LimbVector result(aSize + bSize);
+    ToomCook3MultiplyTo(a, aSize, b, bSize, result.data(), config);
+    return result;
+}
+
+LimbVector ToomCook3Square(const Limb* a, size_t aSize, const MultiplyConfig& config) {
+    LimbVector result(2 * aSize);
+    ToomCook3SquareTo(a, aSize, result.data(), config);
+    return result;
+}
+
+LimbVector ToomCook4Multiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config) {
+    LimbVector result(aSize + bSize);
+    ToomCook4MultiplyTo(a, aSize, b, bSize, result.data(), config);
+    return result;
+}
+
+LimbVector ToomCook4Square(const Limb* a, size_t aSize, const MultiplyConfig& config) {
+    LimbVector result(2 * aSize);
+    ToomCook4SquareTo(a, aSize, result.data(), config);
+    return result;
+}
+
+/* Number-Theoretic Transform Multiplication Algorithm Overview:
+*   - The chunks of each operand are the coefficients of a polynomial, and the product is the convolution
+*     of the two coefficient sequences followed by carry propagation.
+*   - The convolution is computed with a transform modulo a prime p of the form c * 2^k + 1, for which
+*     the 2^k-th roots of unity exist, so it costs O(n log n) instead of O(n^2).
+*   - In binary mode each 64-bit chunk is first cut into NTT_PIECES_PER_LIMB pieces of 16 bits, so that
+*     the coefficients stay in the same range as in decimal mode, where a chunk is used as a whole.
+*   - A coefficient of the convolution can reach min(aSize, bSize) * (LIMB_BASE - 1)^2, which is larger than
+*     any single word-sized prime. The convolution is therefore done modulo three primes and each
+*     coefficient is rebuilt exactly from its three residues with Garner's form of the CRT.
+*   - When squaring, the operand is transformed once per prime and the pointwise products are squares.
+*/
+namespace {
+#ifdef BIGINT_BINARY_LIMBS
+    const WideLimb NTT_PIECE_BASE = (WideLimb)1 << 16;
+#else
+    const WideLimb NTT_PIECE_BASE = LIMB_BASE;
+#endif
+
+    // Primes of the form c * 2^k + 1 that all have 3 as a primitive root. The smallest power of two
+    // among them bounds the transform length to 2^23.
+    const uint32_t NTT_PRIME_1 = 998244353;  // 119 * 2^23 + 1
+    const uint32_t NTT_PRIME_2 = 167772161;  // 5 * 2^25 + 1
+    const uint32_t NTT_PRIME_3 = 469762049;  // 7 * 2^26 + 1
+    const uint32_t NTT_PRIMITIVE_ROOT = 3;
+
+    // Residues of the transformed values, which draw from the ScratchArena like the chunk buffers
+    typedef std::vector<uint32_t, ScratchAllocator<uint32_t>> ResidueVector;
+
+    template <uint32_t Modulus>
+    uint32_t PowMod(uint32_t value, uint64_t exponent) {
+        uint64_t result = 1;
+        uint64_t power = value % Modulus;
+        while (exponent > 0) {
+            if (exponent & 1) {
+                result = result * power % Modulus;
+            }
+            power = power * power % Modulus;
+            exponent >>= 1;
+        }
+        return (uint32_t)result;
+    }
+
+    // In-place iterative transform of a power-of-two sized vector, or its inverse (including the 1/n scaling)
+    template <uint32_t Modulus>
+    void Transform(ResidueVector& values, bool inverse) {
+        size_t n = values.size();
+        for (size_t i = 1, j = 0; i < n; i++) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j) {
+                std::swap(values[i], values[j]);
+            }
+        }
+
+        for (size_t length = 2; length <= n; length <<= 1) {
+            uint32_t rootOfUnity = PowMod<Modulus>(NTT_PRIMITIVE_ROOT, (Modulus - 1) / length);
+            if (inverse) {
+                rootOfUnity = PowMod<Modulus>(rootOfUnity, Modulus - 2);
+            }
+            // Twiddle factors for this stage, computed once and shared by every block
+            ResidueVector twiddles(length / 2);
+            twiddles[0] = 1;
+            for (size_t k = 1; k < length / 2; k++) {
+                twiddles[k] = (uint32_t)((uint64_t)twiddles[k - 1] * rootOfUnity % Modulus);
+            }
+            for (size_t start = 0; start < n; start += length) {
+                for (size_t k = 0; k < length / 2; k++) {
+                    uint32_t even = values[start + k];
+                    uint32_t odd = (uint32_t)((uint64_t)values[start + k + length / 2] * twiddles[k] % Modulus);
+                    values[start + k] = (even + odd >= Modulus) ? even + odd - Modulus : even + odd;
+                    values[start + k + length / 2] = (even >= odd) ? even - odd : even + Modulus - odd;
+                }
+            }
+        }
+
+        if (inverse) {
+            uint64_t nInverse = PowMod<Modulus>((uint32_t)(n % Modulus), Modulus - 2);
+            for (uint32_t& value : values) {
+                value = (uint32_t)(value * nInverse % Modulus);
+            }
+        }
+    }
+
+    // Cuts a chunk buffer into transform coefficients modulo a prime, least significant piece first
+    template <uint32_t Modulus>
+    ResidueVector ToTransformValues(const Limb* num, size_t numSize, size_t transformSize) {
+        ResidueVector values(transformSize, 0);
+        for (size_t i = 0; i < numSize; i++) {
+            WideLimb chunk = num[i];
+            for (size_t j = 0; j < NTT_PIECES_PER_LIMB; j++) {
+                values[i * NTT_PIECES_PER_LIMB + j] = (uint32_t)(chunk % NTT_PIECE_BASE % Modulus);
+                chunk /= NTT_PIECE_BASE;
+            }
+        }
+        return values;
+    }
+
+    // Cyclic convolution of a and b modulo a prime, using transforms of transformSize points. When b is the
+    // same buffer as a, the operand is only transformed once.
+    template <uint32_t Modulus>
+    ResidueVector ConvolveModPrime(const Limb* a, size_t aSize, const Limb* b, size_t bSize, size_t transformSize) {
+        bool isSquare = (a == b && aSize == bSize);
+        ResidueVector aValues = ToTransformValues<Modulus>(a, aSize, transformSize);
+        Transform<Modulus>(aValues, false);
+        if (isSquare) {
+            for (size_t i = 0; i < transformSize; i++) {
+                aValues[i] = (uint32_t)((uint64_t)aValues[i] * aValues[i] % Modulus);
+            }
+        }
+        else {
+            ResidueVector bValues = ToTransformValues<Modulus>(b, bSize, transformSize);
+            Transform<Modulus>(bValues, false);
+            for (size_t i = 0; i < transformSize; i++) {
+                aValues[i] = (uint32_t)((uint64_t)aValues[i] * bValues[i] % Modulus);
+            }
+        }
+        Transform<Modulus>(aValues, true);
+        return aValues;
+    }
+
+    void NttMultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result) {
+        std::fill(result, result + aSize + bSize, 0);
+        if (aSize == 0 || bSize == 0) {
+            return;
+        }
+        size_t pieceCount = (aSize + bSize) * NTT_PIECES_PER_LIMB;
+        size_t transformSize = 1;
+        while (transformSize < pieceCount - 1) {
+            transformSize <<= 1;
+        }
+
+        ResidueVector residues1 = ConvolveModPrime<NTT_PRIME_1>(a, aSize, b, bSize, transformSize);
+        ResidueVector residues2 = ConvolveModPrime<NTT_PRIME_2>(a, aSize, b, bSize, transformSize);
+        ResidueVector residues3 = ConvolveModPrime<NTT_PRIME_3>(a, aSize, b, bSize, transformSize);
+
+        // Garner's constants: the inverse of p1 modulo p2, and of p1 * p2 modulo p3
+        const uint64_t prime1InverseMod2 = PowMod<NTT_PRIME_2>(NTT_PRIME_1, NTT_PRIME_2 - 2);
+        const uint64_t prime12InverseMod3 = PowMod<NTT_PRIME_3>(
+            (uint32_t)((uint64_t)NTT_PRIME_1 * NTT_PRIME_2 % NTT_PRIME_3), NTT_PRIME_3 - 2);
+        const uint64_t prime1Mod3 = NTT_PRIME_1 % NTT_PRIME_3;
+
+        unsigned __int128 carry = 0;
+        WideLimb pieceScale = 1;
+        for (size_t i = 0; i < pieceCount; i++) {
+            if (i < transformSize) {
+                // The coefficient is x1 + x2 * p1 + x3 * p1 * p2 with each xi reduced modulo pi
+                uint64_t x1 = residues1[i];
+                uint64_t x2 = (residues2[i] + NTT_PRIME_2 - x1 % NTT_PRIME_2) % NTT_PRIME_2 * prime1InverseMod2 % NTT_PRIME_2;
+                uint64_t x3 = (residues3[i] + NTT_PRIME_3 - x1 % NTT_PRIME_3) % NTT_PRIME_3;
+                x3 = (x3 + NTT_PRIME_3 - x2 * prime1Mod3 % NTT_PRIME_3) % NTT_PRIME_3 * prime12InverseMod3 % NTT_PRIME_3;
+                carry += x1 + (unsigned __int128)x2 * NTT_PRIME_1 + (unsigned __int128)x3 * NTT_PRIME_1 * NTT_PRIME_2;
+            }
+            // Pieces are put back together into chunks as the carries are propagated
+            if (i % NTT_PIECES_PER_LIMB == 0) {
+                pieceScale = 1;
+            }
+            result[i / NTT_PIECES_PER_LIMB] += (Limb)(carry % NTT_PIECE_BASE * pieceScale);
+            carry /= NTT_PIECE_BASE;
+            pieceScale *= NTT_PIECE_BASE;
+        }
+    }
+}
+
+LimbVector NttMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize) {
+    LimbVector result(aSize + bSize);
+    NttMultiplyTo(a, aSize, b, bSize, result.data());
+    return result;
+}
+
+LimbVector NttSquare(const Limb* a, size_t aSize) {
+    return NttMultiply(a, aSize, a, aSize);
+}
+
+/* Division Overview:
+*   - SchoolbookDivide is Knuth's Algorithm D. Both operands are scaled so that the top chunk of the divisor
+*     is at least half the base, which makes the quotient chunk estimated from the top chunks off by at
+*     most two before correction.
+*   - Reciprocal computes floor(LIMB_BASE^(2m) / divisor) for an m-chunk divisor with Newton's iteration.
+*     The reciprocal of the top half of the divisor is computed recursively, one Newton step doubles its
+*     precision, and a final check against the exact remainder fixes the last few units. Each level costs
+*     a constant number of multiplications, so the whole reciprocal costs O(M(m)).
+*   - DivideWithReciprocal is Barrett's reduction: the quotient is estimated from the top chunks of the
+*     dividend times the reciprocal, and is at most two below the true quotient.
+*/
+namespace {
+    const size_t RECIPROCAL_BASECASE_LIMBS = 16;
+
+    // Returns num / LIMB_BASE^shift, rounded down
+    LimbVector ShiftRightChunks(const LimbVector& num, size_t shift) {
+        if (num.size() <= shift) {
+            return LimbVector();
+        }
+        return LimbVector(num.begin() + shift, num.end());
+    }
+
+    // Returns num * LIMB_BASE^shift
+    LimbVector ShiftLeftChunks(const LimbVector& num, size_t shift) {
+        LimbVector shifted(shift, 0);
+        shifted.insert(shifted.end(), num.begin(), num.end());
+        return shifted;
+    }
+
+    LimbVector MultiplyTrimmed(const LimbVector& a, const LimbVector& b, const MultiplyConfig& config) {
+        LimbVector product = Multiply(a.data(), a.size(), b.data(), b.size(), config);
+        Trim(product);
+        return product;
+    }
+}
+
+void SchoolbookDivideInPlace(Limb* u, size_t uSize, Limb* v, size_t vSize, Limb* quotient) {
+    // Normalize so that the top chunk of the divisor is at least LIMB_BASE / 2
+    size_t n = vSize;
+    size_t m = uSize - n;
+    Limb scale = (Limb)(LIMB_BASE / ((WideLimb)v[n - 1] + 1));
+    u[uSize] = MultiplyAddWordInPlace(u, uSize, scale, 0);
+    MultiplyAddWordInPlace(v, vSize, scale, 0);
+
+    for (size_t j = m + 1; j-- > 0;) {
+        // Estimate the quotient chunk from the top two chunks of the running remainder
+        WideLimb top = (WideLimb)u[j + n] * LIMB_BASE + u[j + n - 1];
+        WideLimb qHat = top / v[n - 1];
+        WideLimb rHat = top % v[n - 1];
+        while (qHat >= LIMB_BASE || qHat * v[n - 2] > rHat * LIMB_BASE + u[j + n - 2]) {
+            qHat--;
+            rHat += v[n - 1];
+            if (rHat >= LIMB_BASE) {
+                break;
+            }
+        }
+
+        // Subtract qHat * v from the running remainder
+        WideLimb carry = 0;
+        Limb borrow = 0;
+        for (size_t i = 0; i < n; i++) {
+            WideLimb product = qHat * v[i] + carry;
+            carry = product / LIMB_BASE;
+            WideLimb diff = (WideLimb)u[i + j] + LIMB_BASE - product % LIMB_BASE - borrow;
+            u[i + j] = (Limb)(diff % LIMB_BASE);
+            borrow = (diff < LIMB_BASE) ? 1 : 0;
+        }
+        WideLimb diff = (WideLimb)u[j + n] + LIMB_BASE - carry - borrow;
+        u[j + n] = (Limb)(diff % LIMB_BASE);
+        borrow = (diff < LIMB_BASE) ? 1 : 0;
+
+        // qHat was one too large, so add v back
+        if (borrow != 0) {
+            qHat--;
+            WideLimb addCarry = 0;
+            for (size_t i = 0; i < n; i++) {
+                addCarry += (WideLimb)u[i + j] + v[i];
+                u[i + j] = (Limb)(addCarry % LIMB_BASE);
+                addCarry /= LIMB_BASE;
+            }
+            u[j + n] = (Limb)(((WideLimb)u[j + n] + addCarry) % LIMB_BASE);
+        }
+        quotient[j] = (Limb)qHat;
+    }
+
+    // The remainder is left in the low n chunks, still scaled
+    DivideByWordInPlace(u, n, scale);
+}
+
+void SchoolbookDivide(const LimbVector& num, const LimbVector& divisor, LimbVector& quotient, LimbVector& remainder) {
+    LimbVector u = num;
+    LimbVector v = divisor;
+    Trim(u);
+    Trim(v);
+    if (CompareMagnitude(u, v) < 0) {
+        quotient.clear();
+        remainder = u;
+        return;
+    }
+    if (v.size() == 1) {
+        quotient = u;
+        Limb rem = DivideByWordInPlace(quotient, v[0]);
+        remainder.assign(rem != 0 ? 1 : 0, rem);
+        return;
+    }
+
+    size_t uSize = u.size();
+    u.resize(uSize + 1, 0);
+    quotient.assign(uSize - v.size() + 1, 0);
+    SchoolbookDivideInPlace(u.data(), uSize, v.data(), v.size(), quotient.data());
+    u.resize(v.size());
+    Trim(u);
+    remainder = u;
+    Trim(quotient);
+}
+
+LimbVector Reciprocal(const LimbVector& divisor, const MultiplyConfig& config) {
+    size_t m = divisor.size();
+    LimbVector powerOfBase(2 * m, 0);
+    powerOfBase.push_back(1);
+    if (m <= RECIPROCAL_BASECASE_LIMBS) {
+        LimbVector quotient, remainder;
+        SchoolbookDivide(powerOfBase, divisor, quotient, remainder);
+        return quotient;
+    }
+
+    // Reciprocal of the top h chunks, scaled up to an approximation of the full reciprocal. Its relative error
+    // is below 2 * LIMB_BASE^(1 - h), and the Newton step squares that, so 2h >= m + 3 leaves a few units.
+    size_t h = (m + 4) / 2;
+    LimbVector divisorTop(divisor.end() - h, divisor.end());
+    LimbVector reciprocalTop = Reciprocal(divisorTop, config);
+    LimbVector estimate = ShiftLeftChunks(reciprocalTop, m - h);
+
+    // Newton step: x = x + x * (B^2m - d * x) / B^2m, where x * (...) / B^2m = reciprocalTop * (...) / B^(m + h).
+    // The low chunks of the estimate are zero, so d * x is computed as d * reciprocalTop shifted into place.
+    SignedValue target = { powerOfBase, false };
+    SignedValue error = SignedSubtract(target, SignedValue{ ShiftLeftChunks(MultiplyTrimmed(divisor, reciprocalTop, config), m - h), false });
+    SignedValue correction = { ShiftRightChunks(MultiplyTrimmed(reciprocalTop, error.magnitude, config), m + h), error.isNegative };
+    Trim(correction.magnitude);
+    SignedValue result = SignedAdd(SignedValue{ estimate, false }, correction);
+
+    // The estimate is now within a few units, so step it with the exact remainder B^2m - d * x
+    SignedValue divisorValue = { divisor, false };
+    SignedValue one = { LimbVector(1, 1), false };
+    SignedValue remainder = SignedSubtract(target, SignedValue{ MultiplyTrimmed(divisor, result.magnitude, config), false });
+    while (remainder.isNegative) {
+        result = SignedSubtract(result, one);
+        remainder = SignedAdd(remainder, divisorValue);
+    }
+    while (CompareMagnitude(remainder.magnitude, divisor) >= 0) {
+        result = SignedAdd(result, one);
+        remainder = SignedSubtract(remainder, divisorValue);
+    }
+    return result.magnitude;
+}
+
+void DivideWithReciprocal(const LimbVector& num, const LimbVector& divisor, const LimbVector& reciprocal,
+    LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config) {
+    size_t m = divisor.size();
+    quotient = ShiftRightChunks(MultiplyTrimmed(ShiftRightChunks(num, m - 1), reciprocal, config), m + 1);
+    Trim(quotient);
+
+    remainder = num;
+    Trim(remainder);
+    SubtractInPlace(remainder, MultiplyTrimmed(quotient, divisor, config));
+    Trim(remainder);
+    while (CompareMagnitude(remainder, divisor) >= 0) {
+        SubtractInPlace(remainder, divisor);
+        Trim(remainder);
+        MultiplyAddWordInPlace(quotient, 1, 1);
+    }
+}
+
+/* Burnikel-Ziegler Division Overview:
+*   - A 2n by n division splits the divisor into halves B1 and B2, and the dividend into four quarters. It is
+*     done as two 3-by-2 steps, each producing one half of the quotient.
+*   - A 3-by-2 step estimates its quotient from the top two thirds of its dividend divided by B1 (a recursive
+*     2n by n division of half the size) and then corrects the estimate with the product of the quotient and B2.
+*     Because the divisor is normalized, the estimate is at most two too large.
+*   - The divisor is padded with low zero chunks to a size of the form j * 2^k with j at most the threshold, so
+*     that the halving reaches the schoolbook base case on even sizes all the way down.
+*   - This costs O(M(n) log n), with the recursive products done by the multiplication dispatcher.
+*/
+namespace {
+    // Returns the chunks of num from position start up to, but not including, position end
+    LimbVector SliceChunks(const LimbVector& num, size_t start, size_t end) {
+        start = std::min(start, num.size());
+        end = std::min(end, num.size());
+        LimbVector slice(num.begin() + start, num.begin() + end);
+        Trim(slice);
+        return slice;
+    }
+
+    void DivideTwoByOne(const LimbVector& a, const LimbVector& b, size_t n, LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config);
+
+    // Divides a 3-half dividend, below b * LIMB_BASE^half, by the 2-half divisor b
+    void DivideThreeHalvesByTwo(const LimbVector& a, const LimbVector& b, size_t half,
+        LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config) {
+        LimbVector aTop = SliceChunks(a, 2 * half, 3 * half);
+        LimbVector aTopTwo = SliceChunks(a, half, 3 * half);
+        LimbVector bHigh = SliceChunks(b, half, 2 * half);
+        LimbVector bLow = SliceChunks(b, 0, half);
+
+        // Estimate the quotient from the top two halves of a and the high half of b
+        LimbVector estimate, partialRemainder;
+        if (CompareMagnitude(aTop, bHigh) < 0) {
+            DivideTwoByOne(aTopTwo, bHigh, half, estimate, partialRemainder, config);
+        }
+        else {
+            // The estimate is LIMB_BASE^half - 1, and its remainder is aTopTwo - bHigh * LIMB_BASE^half + bHigh
+            estimate.assign(half, (Limb)(LIMB_BASE - 1));
+            SignedValue shiftedRemainder = SignedSubtract(MakeSigned(aTopTwo.data(), aTopTwo.size()),
+                SignedValue{ ShiftLeftChunks(bHigh, half), false });
+            partialRemainder = SignedAdd(shiftedRemainder, MakeSigned(bHigh.data(), bHigh.size())).magnitude;
+        }
+
+        // remainder = partialRemainder * LIMB_BASE^half + aLow - estimate * bLow, corrected until it is not negative
+        LimbVector aLow = SliceChunks(a, 0, half);
+        LimbVector combined = ShiftLeftChunks(partialRemainder, half);
+        AddShiftedInPlace(combined, aLow, 0);
+        SignedValue signedRemainder = SignedSubtract(MakeSigned(combined.data(), combined.size()),
+            SignedValue{ MultiplyTrimmed(estimate, bLow, config), false });
+        SignedValue divisorValue = MakeSigned(b.data(), b.size());
+        SignedValue one = { LimbVector(1, 1), false };
+        SignedValue signedQuotient = MakeSigned(estimate.data(), estimate.size());
+        while (signedRemainder.isNegative) {
+            signedQuotient = SignedSubtract(signedQuotient, one);
+            signedRemainder = SignedAdd(signedRemainder, divisorValue);
+        }
+        quotient = signedQuotient.magnitude;
+        remainder = signedRemainder.magnitude;
+    }
+
+    // Divides a, below b * LIMB_BASE^n, by the normalized n-chunk divisor b
+    void DivideTwoByOne(const LimbVector& a, const LimbVector& b, size_t n,
+        LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config) {
+        if (n % 2 != 0 || n <= config.burnikelZieglerThreshold) {
+            SchoolbookDivide(a, b, quotient, remainder);
+            Trim(quotient);
+            Trim(remainder);
+            return;
+        }
+        size_t half = n / 2;
+        LimbVector highQuotient, highRemainder, lowQuotient;
+        DivideThreeHalvesByTwo(SliceChunks(a, half, 4 * half), b, half, highQuotient, highRemainder, config);
+
+        LimbVector nextDividend = ShiftLeftChunks(highRemainder, half);
+        AddShiftedInPlace(nextDividend, SliceChunks(a, 0, half), 0);
+        DivideThreeHalvesByTwo(nextDividend, b, half, lowQuotient, remainder, config);
+
+        quotient = ShiftLeftChunks(highQuotient, half);
+        quotient.resize(std::max(quotient.size(), lowQuotient.size()), 0);
+        AddShiftedInPlace(quotient, lowQuotient, 0);
+        Trim(quotient);
+    }
+
+    // Divides num by divisor one block of divisor.size() chunks at a time from the most significant end. Each
+    // step divides the running remainder followed by the next block, a value below divisor * LIMB_BASE^m, with
+    // either the reciprocal or, when it is null, the Burnikel-Ziegler recursion.
+    void DivideByBlocks(const LimbVector& num, const LimbVector& divisor, const LimbVector* reciprocal,
+        LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config) {
+        size_t m = divisor.size();
+        size_t numBlocks = (num.size() + m - 1) / m;
+        quotient.assign(numBlocks * m, 0);
+        remainder.clear();
+        for (size_t block = numBlocks; block-- > 0;) {
+            LimbVector current = SliceChunks(num, block * m, (block + 1) * m);
+            current.resize(m, 0);
+            current.insert(current.end(), remainder.begin(), remainder.end());
+            Trim(current);
+
+            LimbVector blockQuotient;
+            if (reciprocal != nullptr) {
+                DivideWithReciprocal(current, divisor, *reciprocal, blockQuotient, remainder, config);
+            }
+            else {
+                DivideTwoByOne(current, divisor, m, blockQuotient, remainder, config);
+            }
+            std::copy(blockQuotient.begin(), blockQuotient.end(), quotient.begin() + block * m);
+        }
+        Trim(quotient);
+        Trim(remainder);
+    }
+}
+
+void BurnikelZieglerDivide(const LimbVector& num, const LimbVector& divisor,
+    LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config) {
+    LimbVector u = num;
+    LimbVector v = divisor;
+    Trim(u);
+    Trim(v);
+
+    // Pad the divisor with low zero chunks up to a size that halves evenly down to the base case
+    size_t baseSize = v.size();
+    size_t halvings = 0;
+    while (baseSize > std::max<size_t>(config.burnikelZieglerThreshold, 1)) {
+        baseSize = (baseSize + 1) / 2;
+        halvings++;
+    }
+    size_t padding = (baseSize << halvings) - v.size();
+    u = ShiftLeftChunks(u, padding);
+    v = ShiftLeftChunks(v, padding);
+
+    // Normalize so that the top chunk of the divisor is at least LIMB_BASE / 2, as in SchoolbookDivide
+    Limb scale = (Limb)(LIMB_BASE / ((WideLimb)v.back() + 1));
+    MultiplyAddWordInPlace(u, scale, 0);
+    MultiplyAddWordInPlace(v, scale, 0);
+
+    DivideByBlocks(u, v, nullptr, quotient, remainder, config);
+
+    // Undo the padding and the normalization on the remainder, the quotient is unchanged by both
+    remainder = ShiftRightChunks(remainder, padding);
+    DivideByWordInPlace(remainder, scale);
+    Trim(remainder);
+}
+
+LimbVector BarrettReduce(const LimbVector& num, const LimbVector& modulus, const LimbVector& reciprocal,
+    const MultiplyConfig& config) {
+    LimbVector u = num;
+    Trim(u);
+    LimbVector quotient, remainder;
+    if (u.size() <= 2 * modulus.size()) {
+        DivideWithReciprocal(u, modulus, reciprocal, quotient, remainder, config);
+    }
+    else {
+        DivideByBlocks(u, modulus, &reciprocal, quotient, remainder, config);
+    }
+    Trim(remainder);
+    return remainder;
+}
+
+void Divide(const LimbVector& num, const LimbVector& divisor,
+    LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config) {
+    LimbVector u = num;
+    LimbVector v = divisor;
+    Trim(u);
+    Trim(v);
+    if (CompareMagnitude(u, v) < 0) {
+        quotient.clear();
+        remainder = u;
+        return;
+    }
+
+    // Schoolbook division costs O(m * (n - m)), so it stays best whenever either the divisor or the quotient is short
+    size_t m = v.size();
+    size_t quotientSize = u.size() - m + 1;
+    if (std::min(m, quotientSize) < config.burnikelZieglerThreshold) {
+        SchoolbookDivide(u, v, quotient, remainder);
+    }
+    else if (m >= config.newtonDivisionThreshold) {
+        LimbVector reciprocal = Reciprocal(v, config);
+        DivideByBlocks(u, v, &reciprocal, quotient, remainder, config);
+    }
+    else {
+        BurnikelZieglerDivide(u, v, quotient, remainder, config);
+    }
+    Trim(quotient);
+    Trim(remainder);
+}
+
+/* Decimal Parsing Overview:
+*   - In decimal mode a chunk is a group of DIGITS_PER_LIMB digits, so each chunk is read straight from its
+*     digits in a single linear pass.
+*   - In binary mode the digit string is split so that the low part has DIGITS_PER_LIMB * 2^k digits, the
+*     largest such size below the string length. The value is high * 10^(DIGITS_PER_LIMB * 2^k) + low,
+*     where both halves are parsed recursively and the power of ten comes from a cache. With a fast
+*     multiplication this is O(M(n) log n) instead of the O(n^2) of folding in one word at a time, which
+*     is only used once the string is below CONVERSION_BASECASE_LIMBS chunks.
+*/
+namespace {
+    const size_t CONVERSION_BASECASE_LIMBS = 32;
+
+    // Reads up to DIGITS_PER_LIMB decimal digits into a single chunk
+    Limb ParseDigitGroup(const char* digits, size_t numDigits) {
+        Limb value = 0;
+        for (size_t i = 0; i < numDigits; i++) {
+            if (digits[i] < '0' || digits[i] > '9') {
+                throw std::invalid_argument("BigInt: invalid decimal digit in input string");
+            }
+            value = value * 10 + (Limb)(digits[i] - '0');
+        }
+        return value;
+    }
+
+    void TrimChunks(LimbVector& num) {
+        while (num.size() > 1 && num.back() == 0) {
+            num.pop_back();
+        }
+    }
+
+#ifdef BIGINT_BINARY_LIMBS
+    LimbVector ParseDecimalRecursive(const char* digits, size_t numDigits, const MultiplyConfig& config) {
+        if (numDigits <= CONVERSION_BASECASE_LIMBS * DIGITS_PER_LIMB) {
+            // Fold the digits in one group at a time, most significant first, with the first group taking
+            // whatever is left over
+            LimbVector result;
+            size_t groupSize = (numDigits % DIGITS_PER_LIMB != 0) ? numDigits % DIGITS_PER_LIMB : DIGITS_PER_LIMB;
+            for (size_t i = 0; i < numDigits; i += groupSize, groupSize = DIGITS_PER_LIMB) {
+                Limb groupScale = 1;
+                for (size_t j = 0; j < groupSize; j++) {
+                    groupScale *= 10;
+                }
+                MultiplyAddWordInPlace(result, groupScale, ParseDigitGroup(digits + i, groupSize));
+            }
+            return result;
+        }
+
+        size_t k = 0;
+        while (DIGITS_PER_LIMB * ((size_t)2 << k) < numDigits) {
+            k++;
+        }
+        size_t lowDigits = DIGITS_PER_LIMB * ((size_t)1 << k);
+        LimbVector high = ParseDecimalRecursive(digits, numDigits - lowDigits, config);
+        LimbVector low = ParseDecimalRecursive(digits + numDigits - lowDigits, lowDigits, config);
+        const LimbVector& power = GetPowerOfTen(k, config);
+
+        LimbVector result = Multiply(high.data(), high.size(), power.data(), power.size(), config);
+        AddShiftedInPlace(result, low, 0);
+        return result;
+    }
+#endif
+}
+
+namespace {
+    // Powers 10^(DIGITS_PER_LIMB * 2^k) and their reciprocals, shared by all threads. Deques keep references to
+    // the cached values valid while later ones are appended. The cache outlives any ScratchArena scope, so it is
+    // always grown from the heap.
+    struct PowerOfTenCache {
+        std::deque<LimbVector> powers;
+        std::deque<LimbVector> reciprocals;
+        std::mutex mutex;
+    };
+
+    PowerOfTenCache& GetPowerOfTenCache() {
+        static PowerOfTenCache cache;
+        return cache;
+    }
+
+    // Grows the cached powers up to index k, the cache mutex must be held
+    void ExtendPowersOfTen(PowerOfTenCache& cache, size_t k, const MultiplyConfig& config) {
+        if (cache.powers.empty()) {
+            LimbVector firstPower(1, 1);
+            for (size_t i = 0; i < DIGITS_PER_LIMB; i++) {
+                MultiplyAddWordInPlace(firstPower, 10, 0);
+            }
+            cache.powers.push_back(firstPower);
+        }
+        while (cache.powers.size() <= k) {
+            const LimbVector& previous = cache.powers.back();
+            LimbVector next = Square(previous.data(), previous.size(), config);
+            TrimChunks(next);
+            cache.powers.push_back(next);
+        }
+    }
+}
+
+const LimbVector& GetPowerOfTen(size_t k, const MultiplyConfig& config) {
+    PowerOfTenCache& cache = GetPowerOfTenCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    ScratchArena::Suspend suspend;
+    ExtendPowersOfTen(cache, k, config);
+    return cache.powers[k];
+}
+
+const LimbVector& GetPowerOfTenReciprocal(size_t k, const MultiplyConfig& config) {
+    PowerOfTenCache& cache = GetPowerOfTenCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    ScratchArena::Suspend suspend;
+    ExtendPowersOfTen(cache, k, config);
+    while (cache.reciprocals.size() <= k) {
+        cache.reciprocals.push_back(Reciprocal(cache.powers[cache.reciprocals.size()], config));
+    }
+    return cache.reciprocals[k];
+}
+
+LimbVector ParseDecimal(const char* digits, size_t numDigits, const MultiplyConfig& config) {
+#ifdef BIGINT_BINARY_LIMBS
+    LimbVector result = ParseDecimalRecursive(digits, numDigits, config);
+#else
+    // Each chunk is read directly from its digits, least significant chunk first
+    LimbVector result((numDigits + DIGITS_PER_LIMB - 1) / DIGITS_PER_LIMB);
+    for (size_t i = 0; i < result.size(); i++) {
+        size_t end = numDigits - i * DIGITS_PER_LIMB;
+        size_t start = (end > DIGITS_PER_LIMB) ? end - DIGITS_PER_LIMB : 0;
+        result[i] = ParseDigitGroup(digits + start, end - start);
+    }
+    (void)config;
+#endif
+    if (result.empty()) {
+        result.push_back(0);
+    }
+    TrimChunks(result);
+    return result;
+}
+
+/* Decimal Formatting Overview:
+*   - The digits are written straight into a string that is allocated once at its final size (or, in binary
+*     mode, at an upper bound that is trimmed once at the end).
+*   - In decimal mode every chunk but the most significant is written as exactly DIGITS_PER_LIMB digits.
+*   - In binary mode a value below 10^(DIGITS_PER_LIMB * 2^(k + 1)) is divided by the cached power
+*     10^(DIGITS_PER_LIMB * 2^k), using its cached reciprocal, into a high and a low half that are formatted
+*     recursively into the two halves of the output. This costs O(M(n) log n) instead of the O(n^2) of
+*     dividing by a single word repeatedly, which is only used below CONVERSION_BASECASE_LIMBS chunks.
+*/
+namespace {
+#ifdef BIGINT_BINARY_LIMBS
+    // Writes exactly numDigits digits of a value below 10^numDigits, zero padded, by peeling off one chunk's
+    // worth of digits at a time from the least significant end
+    void FormatDigitGroups(LimbVector num, char* out, size_t numDigits) {
+        Limb groupScale = 1;
+        for (size_t i = 0; i < DIGITS_PER_LIMB; i++) {
+            groupScale *= 10;
+        }
+        Trim(num);
+        size_t position = numDigits;
+        while (position > 0) {
+            Limb group = num.empty() ? 0 : DivideByWordInPlace(num, groupScale);
+            for (size_t i = 0; i < DIGITS_PER_LIMB && position > 0; i++) {
+                out[--position] = (char)('0' + group % 10);
+                group /= 10;
+            }
+        }
+    }
+
+    // Writes the DIGITS_PER_LIMB * 2^(k + 1) digits of a value below the square of the k-th cached power
+    void FormatDecimalRecursive(const LimbVector& num, size_t k, char* out, const MultiplyConfig& config) {
+        size_t halfDigits = DIGITS_PER_LIMB * ((size_t)1 << k);
+        if (k == 0 || num.size() <= CONVERSION_BASECASE_LIMBS) {
+            FormatDigitGroups(num, out, 2 * halfDigits);
+            return;
+        }
+        LimbVector high, low;
+        DivideWithReciprocal(num, GetPowerOfTen(k, config), GetPowerOfTenReciprocal(k, config), high, low, config);
+        FormatDecimalRecursive(high, k - 1, out, config);
+        FormatDecimalRecursive(low, k - 1, out + halfDigits, config);
+    }
+#endif
+}
+
+std::string FormatDecimal(const LimbVector& num, const MultiplyConfig& config) {
+    LimbVector trimmed = num;
+    TrimChunks(trimmed);
+    if (trimmed.empty()) {
+        return "0";
+    }
+#ifdef BIGINT_BINARY_LIMBS
+    // A 64-bit chunk holds fewer than 20 decimal digits, so this many digits always suffice
+    size_t k = 0;
+    while (DIGITS_PER_LIMB * ((size_t)2 << k) < 20 * trimmed.size()) {
+        k++;
+    }
+    std::string result(DIGITS_PER_LIMB * ((size_t)2 << k), '0');
+    FormatDecimalRecursive(trimmed, k, &result[0], config);
+    size_t firstDigit = std::min(result.find_first_not_of('0'), result.size() - 1);
+    result.erase(0, firstDigit);
+#else
+    // The most significant chunk is written without padding, every other chunk as exactly DIGITS_PER_LIMB digits
+    std::string topDigits = std::to_string(trimmed.back());
+    std::string result(topDigits.size() + DIGITS_PER_LIMB * (trimmed.size() - 1), '0');
+    std::copy(topDigits.begin(), topDigits.end(), result.begin());
+    for (size_t i = 0; i + 1 < trimmed.size(); i++) {
+        Limb chunk = trimmed[i];
+        for (size_t j = 0; j < DIGITS_PER_LIMB; j++) {
+            result[result.size() - 1 - i * DIGITS_PER_LIMB - j] = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+    }
+    (void)config;
+#endif
+    return result;
+}
+
+/* Modular Exponentiation Overview:
+*   - Every intermediate is reduced modulo the modulus, so no value grows past twice the modulus size.
+*   - When the modulus M is coprime to the chunk base (odd in binary mode, coprime to 10 in decimal mode),
+*     residues are kept in Montgomery form x * R mod M with R = LIMB_BASE^n for an n-chunk modulus. A
+*     product is reduced by adding the multiple of M that clears its lowest chunk, n times, and dropping
+*     the n cleared chunks (REDC), which costs O(n^2) and needs no division.
+*   - Other moduli, and moduli of MONTGOMERY_MAX_LIMBS chunks or more where the quadratic REDC loses to fast
+*     multiplication, are reduced with Barrett's reduction against a reciprocal of the modulus computed once.
+*   - The exponent is scanned from its top bit with sliding windows, as in BigInt::powerOf.
+*/
+int SlidingWindowWidth(size_t exponentBits) {
+    // A window of width k needs 2^(k - 1) multiplications up front and then about one per k + 1 bits
+    const size_t windowBitLimits[] = { 9, 25, 70 };
+    int width = 1;
+    while (width < 4 && exponentBits > windowBitLimits[width - 1]) {
+        width++;
+    }
+    return width;
+}
+
+namespace {
+    // Returns -m0^-1 modulo LIMB_BASE for a chunk m0 that is coprime to the base
+    Limb NegativeInverseModBase(Limb m0) {
+#ifdef BIGINT_BINARY_LIMBS
+        // An odd m0 is its own inverse modulo 8, and each Newton step doubles the number of correct low bits
+        Limb inverse = m0;
+        for (int i = 0; i < 5; i++) {
+            inverse *= 2 - m0 * inverse;
+        }
+        return (Limb)(0 - inverse);
+#else
+        // Extended Euclid on m0 and the base
+        int64_t oldRemainder = m0, remainder = (int64_t)LIMB_BASE;
+        int64_t oldCoefficient = 1, coefficient = 0;
+        while (remainder != 0) {
+            int64_t quotient = oldRemainder / remainder;
+            int64_t nextRemainder = oldRemainder - quotient * remainder;
+            oldRemainder = remainder;
+            remainder = nextRemainder;
+            int64_t nextCoefficient = oldCoefficient - quotient * coefficient;
+            oldCoefficient = coefficient;
+            coefficient = nextCoefficient;
+        }
+        int64_t inverse = ((oldCoefficient % (int64_t)LIMB_BASE) + (int64_t)LIMB_BASE) % (int64_t)LIMB_BASE;
+        return (Limb)(((int64_t)LIMB_BASE - inverse) % (int64_t)LIMB_BASE);
+#endif
+    }
+
+    // Returns the bits of num, least significant first, without zero bits at the top
+    std::vector<uint8_t> ToBits(LimbVector num) {
+        std::vector<uint8_t> bits;
+#ifdef BIGINT_BINARY_LIMBS
+        for (Limb chunk : num) {
+            for (int i = 0; i < 64; i++) {
+                bits.push_back((uint8_t)((chunk >> i) & 1));
+            }
+        }
+#else
+        // Peel off 29 bits at a time, the largest power of two below the decimal base
+        Trim(num);
+        while (!num.empty()) {
+            Limb digit = DivideByWordInPlace(num, (Limb)1 << 29);
+            for (int i = 0; i < 29; i++) {
+                bits.push_back((uint8_t)((digit >> i) & 1));
+            }
+        }
+#endif
+        while (!bits.empty() && bits.back() == 0) {
+            bits.pop_back();
+        }
+        return bits;
+    }
+
+    // Size from which the quadratic Montgomery reduction no longer beats Barrett's reduction on fast multiplication
+    const size_t MONTGOMERY_MAX_LIMBS = 512;
+
+    // Multiplies residues modulo a fixed modulus, in Montgomery form when the modulus allows it and with
+    // Barrett's reduction otherwise
+    struct ModularMultiplier {
+        LimbVector modulus;
+        bool useMontgomery;
+        Limb negativeInverse;
+        const LimbVector* reciprocal;
+        MultiplyConfig config;
+
+        // Returns x mod modulus, through the reciprocal when there is one and the division dispatcher otherwise
+        LimbVector Reduce(const LimbVector& x) const {
+            if (reciprocal != nullptr) {
+                return BarrettReduce(x, modulus, *reciprocal, config);
+            }
+            LimbVector quotient, remainder;
+            Divide(x, modulus, quotient, remainder, config);
+            return remainder;
+        }
+
+        // Returns t / R mod modulus for t < modulus * R
+        LimbVector MontgomeryReduce(LimbVector t) const {
+            size_t n = modulus.size();
+            t.resize(2 * n + 1, 0);
+            for (size_t i = 0; i < n; i++) {
+                // Adding u * modulus * LIMB_BASE^i clears chunk i
+                Limb u = (Limb)(((WideLimb)t[i] * negativeInverse) % LIMB_BASE);
+                WideLimb carry = 0;
+                for (size_t j = 0; j < n; j++) {
+                    carry += (WideLimb)u * modulus[j] + t[i + j];
+                    t[i + j] = (Limb)(carry % LIMB_BASE);
+                    carry /= LIMB_BASE;
+                }
+                for (size_t k = i + n; carry != 0; k++) {
+                    carry += t[k];
+                    t[k] = (Limb)(carry % LIMB_BASE);
+                    carry /= LIMB_BASE;
+                }
+            }
+            LimbVector result(t.begin() + n, t.end());
+            Trim(result);
+            if (CompareMagnitude(result, modulus) >= 0) {
+                SubtractInPlace(result, modulus);
+                Trim(result);
+            }
+            return result;
+        }
+
+        LimbVector MultiplyMod(const LimbVector& a, const LimbVector& b) const {
+            LimbVector product = MultiplyTrimmed(a, b, config);
+            return useMontgomery ? MontgomeryReduce(product) : Reduce(product);
+        }
+
+        LimbVector SquareMod(const LimbVector& a) const {
+            LimbVector product = Square(a.data(), a.size(), config);
+            Trim(product);
+            return useMontgomery ? MontgomeryReduce(product) : Reduce(product);
+        }
+
+        // Converts into and out of the working form, x * R mod modulus for Montgomery and x itself otherwise
+        LimbVector ToWorkingForm(const LimbVector& x) const {
+            return useMontgomery ? Reduce(ShiftLeftChunks(x, modulus.size())) : x;
+        }
+
+        LimbVector FromWorkingForm(const LimbVector& x) const {
+            return useMontgomery ? MontgomeryReduce(x) : x;
+        }
+    };
+}
+
+LimbVector PowMod(const LimbVector& base, const LimbVector& exponent, const LimbVector& modulus,
+    const LimbVector* reciprocal, const MultiplyConfig& config) {
+    ModularMultiplier multiplier;
+    multiplier.modulus = modulus;
+    Trim(multiplier.modulus);
+    multiplier.config = config;
+#ifdef BIGINT_BINARY_LIMBS
+    bool isCoprimeToBase = (multiplier.modulus[0] % 2 != 0);
+#else
+    bool isCoprimeToBase = (multiplier.modulus[0] % 2 != 0 && multiplier.modulus[0] % 5 != 0);
+#endif
+    multiplier.useMontgomery = isCoprimeToBase && multiplier.modulus.size() < MONTGOMERY_MAX_LIMBS;
+    multiplier.negativeInverse = multiplier.useMontgomery ? NegativeInverseModBase(multiplier.modulus[0]) : 0;
+
+    // Barrett's reduction needs the reciprocal, which is only computed here if the caller has none cached
+    LimbVector ownReciprocal;
+    multiplier.reciprocal = nullptr;
+    if (!multiplier.useMontgomery) {
+        if (reciprocal == nullptr) {
+            ownReciprocal = Reciprocal(multiplier.modulus, config);
+            reciprocal = &ownReciprocal;
+        }
+        multiplier.reciprocal = reciprocal;
+    }
+
+    // base^0 is one, which reduces to zero only for a modulus of one
+    std::vector<uint8_t> bits = ToBits(exponent);
+    if (bits.empty()) {
+        return multiplier.Reduce(LimbVector(1, 1));
+    }
+
+    LimbVector baseForm = multiplier.ToWorkingForm(base);
+    int windowWidth = SlidingWindowWidth(bits.size());
+
+    // oddPowers[i] holds base^(2i + 1) in the working form
+    std::vector<LimbVector> oddPowers(1, baseForm);
+    if (windowWidth > 1) {
+        LimbVector baseSquared = multiplier.SquareMod(baseForm);
+        while (oddPowers.size() < ((size_t)1 << (windowWidth - 1))) {
+            oddPowers.push_back(multiplier.MultiplyMod(oddPowers.back(), baseSquared));
+        }
+    }
+
+    // The top bit is set, so the first window starts the result and no power of one is ever squared
+    LimbVector result;
+    bool isResultOne = true;
+    size_t bit = bits.size();
+    while (bit-- > 0) {
+        if (bits[bit] == 0) {
+            result = multiplier.SquareMod(result);
+            continue;
+        }
+        size_t lowBit = (bit + 1 >= (size_t)windowWidth) ? bit + 1 - windowWidth : 0;
+        while (bits[lowBit] == 0) {
+            lowBit++;
+        }
+        size_t windowValue = 0;
+        for (size_t i = bit + 1; i-- > lowBit;) {
+            windowValue = 2 * windowValue + bits[i];
+        }
+        if (isResultOne) {
+            result = oddPowers[windowValue >> 1];
+            isResultOne = false;
+        }
+        else {
+            for (size_t i = lowBit; i <= bit; i++) {
+                result = multiplier.SquareMod(result);
+            }
+            result = multiplier.MultiplyMod(result, oddPowers[windowValue >> 1]);
+        }
+        bit = lowBit;
+    }
+    return multiplier.FromWorkingForm(result);
+}
+
+}
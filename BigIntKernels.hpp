@@ -0,0 +1,177 @@
+/***************************************************************************************************
+* Module Name: BigInt Arithmetic Kernels Definition
+*
+* Date: October, 2026
+*
+* Module Description:
+*	The BigInt kernels header provides the interface definition for the low-level limb routines
+*	used by the BigInt class. The kernels work on raw chunk buffers rather than BigInt objects so
+*	that the recursive algorithms can split their operands without creating intermediate objects.
+*
+* Notes:
+*   - Like BigInt itself, every kernel works on little-endian buffers (least significant chunk
+*	  first). By default a chunk is a base 10^9 digit in a uint32_t with 64-bit intermediate
+*	  products. Building with BIGINT_BINARY_LIMBS defined switches every kernel to native binary
+*	  chunks of base 2^64 with 128-bit intermediate products.
+*   - The base is the compile-time constant LIMB_BASE, so the divisions and remainders by it in the
+*	  carry handling compile down to multiplications by a reciprocal, or to plain shifts and
+*	  truncations in binary mode.
+*   - Each multiplication kernel returns exactly aSize + bSize chunks (2 * aSize for squaring), possibly with leading
+*	  zero chunks at the most significant end.
+*   - Every buffer a kernel allocates is a LimbVector, whose ScratchAllocator takes it from the thread's
+*	  ScratchArena while a Scope is open and from the heap otherwise. Results that outlive the Scope
+*	  have to be copied out of it.
+*	- The MultiplyConfig struct carries the algorithm thresholds through the
+*	  recursion so that every level dispatches with the same settings. The multiplication thresholds
+*	  are expected to be ordered, with karatsubaThreshold <= toom3Threshold <= toom4Threshold <= nttThreshold,
+*	  and the division ones with burnikelZieglerThreshold <= newtonDivisionThreshold.
+*
+***************************************************************************************************/
+
+#pragma once
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "ScratchArena.hpp"
+
+namespace BigIntKernels {
+	// Chunk type used by the kernels, a wider type to hold products of two chunks, and the chunk base
+#ifdef BIGINT_BINARY_LIMBS
+	typedef uint64_t Limb;
+	typedef unsigned __int128 WideLimb;
+	const WideLimb LIMB_BASE = (WideLimb)1 << 64;
+	const size_t DIGITS_PER_LIMB = 19;
+	const size_t NTT_PIECES_PER_LIMB = 4;
+	const size_t MAX_WORD_CHUNKS = 1;
+#else
+	typedef uint32_t Limb;
+	typedef uint64_t WideLimb;
+	const WideLimb LIMB_BASE = 1000000000;
+	const size_t DIGITS_PER_LIMB = 9;
+	const size_t NTT_PIECES_PER_LIMB = 1;
+	const size_t MAX_WORD_CHUNKS = 3;
+#endif
+
+	// Chunk buffer used by every kernel, which draws from the thread's ScratchArena while a Scope is open
+	typedef std::vector<Limb, ScratchAllocator<Limb>> LimbVector;
+
+	// Settings shared by every level of a recursive multiplication or division
+	struct MultiplyConfig {
+		size_t karatsubaThreshold;
+		size_t toom3Threshold;
+		size_t toom4Threshold;
+		size_t nttThreshold;
+		size_t burnikelZieglerThreshold;
+		size_t newtonDivisionThreshold;
+	};
+
+	// Largest product, in chunks, that the number-theoretic transform can handle with its choice of primes
+	const size_t NTT_MAX_SIZE = ((size_t)1 << 23) / NTT_PIECES_PER_LIMB;
+
+	// Helper functions for adding and subtracting little-endian chunk buffers. The pointer forms never allocate:
+	// AddInPlace needs aSize >= bSize and returns the carry out of a, and SubtractInPlace needs a >= b.
+	LimbVector Add(const Limb* a, size_t aSize, const Limb* b, size_t bSize);
+	Limb AddInPlace(Limb* a, size_t aSize, const Limb* b, size_t bSize);
+	void SubtractInPlace(Limb* a, size_t aSize, const Limb* b, size_t bSize);
+	void SubtractInPlace(LimbVector& a, const LimbVector& b);
+	void AddShiftedInPlace(LimbVector& acc, const LimbVector& x, size_t shift);
+	void AddShiftedInPlace(Limb* acc, size_t accSize, const LimbVector& x, size_t shift);
+
+	// Compares the values of two chunk buffers, ignoring zero chunks at their most significant end, and
+	// returns -1, 0 or 1 as a is less than, equal to or greater than b
+	int Compare(const Limb* a, size_t aSize, const Limb* b, size_t bSize);
+
+	// Word-sized helpers used to convert between decimal strings and binary chunks, and for arithmetic with
+	// native integers. The first computes
+	// num = num * factor + addend, the second divides num by divisor and returns the remainder. The pointer forms
+	// keep the size of num, returning the carry chunk or leaving zero chunks at the top instead.
+	void MultiplyAddWordInPlace(LimbVector& num, Limb factor, Limb addend);
+	Limb MultiplyAddWordInPlace(Limb* num, size_t numSize, Limb factor, Limb addend);
+	Limb DivideByWordInPlace(LimbVector& num, Limb divisor);
+	Limb DivideByWordInPlace(Limb* num, size_t numSize, Limb divisor);
+
+	// Converts a native integer to trimmed chunks, at most MAX_WORD_CHUNKS of them, so zero has none. The pointer
+	// form writes them to chunks and returns how many there are.
+	LimbVector ChunksFromWord(uint64_t value);
+	size_t ChunksFromWord(uint64_t value, Limb* chunks);
+
+	// Reads a string of up to 19 decimal digits, which always fits in 64 bits. Throws std::invalid_argument on
+	// any other character.
+	uint64_t ParseDecimalWord(const char* digits, size_t numDigits);
+
+	// Division kernels. SchoolbookDivide sets quotient and remainder for any non-zero divisor. Reciprocal
+	// returns floor(LIMB_BASE^(2m) / divisor) for an m-chunk divisor, and DivideWithReciprocal uses it to
+	// divide any num below LIMB_BASE^(2m). Divisors must not have zero chunks at their most significant end.
+	void SchoolbookDivide(const LimbVector& num, const LimbVector& divisor, LimbVector& quotient, LimbVector& remainder);
+	LimbVector Reciprocal(const LimbVector& divisor, const MultiplyConfig& config);
+	void DivideWithReciprocal(const LimbVector& num, const LimbVector& divisor, const LimbVector& reciprocal,
+		LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config);
+
+	// Knuth's long division on caller-owned buffers, which never allocates. u and v must be trimmed, with u >= v and at
+	// least two chunks in v. u needs room for uSize + 1 chunks and v is scaled in place. quotient receives
+	// uSize - vSize + 1 chunks, and the low vSize chunks of u are left holding the remainder.
+	void SchoolbookDivideInPlace(Limb* u, size_t uSize, Limb* v, size_t vSize, Limb* quotient);
+
+	// Division dispatcher for any num and non-zero divisor, which picks schoolbook, Burnikel-Ziegler or Newton
+	// reciprocal division from the operand sizes and the thresholds in config. Quotient and remainder are trimmed,
+	// so zero is returned as an empty vector.
+	void Divide(const LimbVector& num, const LimbVector& divisor,
+		LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config);
+	void BurnikelZieglerDivide(const LimbVector& num, const LimbVector& divisor,
+		LimbVector& quotient, LimbVector& remainder, const MultiplyConfig& config);
+
+	// Returns num mod modulus for any num, from the reciprocal of the modulus returned by Reciprocal
+	LimbVector BarrettReduce(const LimbVector& num, const LimbVector& modulus, const LimbVector& reciprocal,
+		const MultiplyConfig& config);
+
+	// Return 10^(DIGITS_PER_LIMB * 2^k) and its reciprocal, from a cache that is shared by all threads and grown on demand
+	const LimbVector& GetPowerOfTen(size_t k, const MultiplyConfig& config);
+	const LimbVector& GetPowerOfTenReciprocal(size_t k, const MultiplyConfig& config);
+
+	// Converts a string of decimal digits to trimmed chunks. Throws std::invalid_argument on any other character.
+	LimbVector ParseDecimal(const char* digits, size_t numDigits, const MultiplyConfig& config);
+
+	// Converts chunks to their decimal string, without leading zeros
+	std::string FormatDecimal(const LimbVector& num, const MultiplyConfig& config);
+
+	// Widest sliding window worth its table of odd powers for an exponent with exponentBits bits
+	int SlidingWindowWidth(size_t exponentBits);
+
+	// Returns base^exponent mod modulus for base < modulus and a non-zero modulus, using Montgomery
+	// multiplication when the modulus is coprime to LIMB_BASE and Barrett's reduction otherwise. The reciprocal
+	// of the modulus may be passed in when it is already known, or left null. The result is trimmed, so zero is empty.
+	LimbVector PowMod(const LimbVector& base, const LimbVector& exponent, const LimbVector& modulus,
+		const LimbVector* reciprocal, const MultiplyConfig& config);
+
+	// Multiplication and squaring dispatchers, which pick the kernel from the operand sizes and the thresholds in config
+	LimbVector Multiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config);
+	LimbVector Square(const Limb* a, size_t aSize, const MultiplyConfig& config);
+
+	// Variants of the dispatchers that leave the same untrimmed product in out, which must not overlap the operands.
+	// Every tier writes its top-level product straight into out. The Into forms resize out without giving up its
+	// capacity, so a caller that reserves it once reuses it for every product, and the To forms write the
+	// aSize + bSize (2 * aSize for squaring) chunks to a raw buffer instead.
+	void MultiplyTo(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* out, const MultiplyConfig& config);
+	void SquareTo(const Limb* a, size_t aSize, Limb* out, const MultiplyConfig& config);
+	void MultiplyInto(const Limb* a, size_t aSize, const Limb* b, size_t bSize, LimbVector& out, const MultiplyConfig& config);
+	void SquareInto(const Limb* a, size_t aSize, LimbVector& out, const MultiplyConfig& config);
+
+	// Multiplication kernels. Apart from the schoolbook kernel, these expect roughly balanced operands
+	// (2 * bSize > aSize >= bSize) and leave the recursive products to the dispatcher.
+	LimbVector SchoolbookMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize);
+	LimbVector KaratsubaMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config);
+	LimbVector ToomCook3Multiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config);
+	LimbVector ToomCook4Multiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, const MultiplyConfig& config);
+
+	// Number-theoretic transform multiplication, exact for any operand sizes with aSize + bSize <= NTT_MAX_SIZE
+	LimbVector NttMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize);
+
+	// Squaring kernels, returning exactly 2 * aSize chunks. Each one does the work of its multiplication
+	// counterpart on a single operand, so it skips duplicated cross products or transforms.
+	LimbVector SchoolbookSquare(const Limb* a, size_t aSize);
+	LimbVector KaratsubaSquare(const Limb* a, size_t aSize, const MultiplyConfig& config);
+	LimbVector ToomCook3Square(const Limb* a, size_t aSize, const MultiplyConfig& config);
+	LimbVector ToomCook4Square(const Limb* a, size_t aSize, const MultiplyConfig& config);
+	LimbVector NttSquare(const Limb* a, size_t aSize);
+}
@@ -0,0 +1,328 @@
+/***************************************************************************************************
+* Module Name: BigInt SIMD Kernels Implementation
+*
+* Date: October, 2026
+*
+* Module Description:
+*	This module contains the AVX2, AVX-512 and AVX-512 IFMA versions of the schoolbook kernels, and
+*	the CPUID detection that decides which of them run.
+*
+* Notes:
+*   - Each vectorized function is compiled for its own instruction set with the target attribute, so
+*	  the rest of the program keeps the baseline x86-64 instructions and the functions are only called
+*	  after __builtin_cpu_supports has confirmed that the processor and the OS support them.
+*   - The kernels sum a run of result columns per vector rather than the products of one column, so a
+*	  product never crosses lanes and no horizontal sums or reversing shuffles are needed.
+*   - The IFMA kernel adds the low and the high 52 bits of each digit product into separate sums for
+*	  each column. A sum of n digit products stays below n * 2^52, so both sums fit in 64 bits together
+*	  for operands of up to SIMD_MULTIPLY_MAX_CHUNKS chunks.
+*
+***************************************************************************************************/
+
+#include "BigIntSimd.hpp"
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define BIGINT_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace BigIntKernels {
+
+namespace {
+    SimdLevel DetectSimdLevel() {
+#ifdef BIGINT_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma")) {
+            return SimdLevel::Avx512Ifma;
+        }
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::Avx2;
+        }
+#endif
+        return SimdLevel::Scalar;
+    }
+
+    // Function-local, as the BigInt thresholds read the level while the static objects are being initialized
+    std::atomic<SimdLevel>& ActiveSimdLevel() {
+        static std::atomic<SimdLevel> activeLevel(GetSupportedSimdLevel());
+        return activeLevel;
+    }
+}
+
+SimdLevel GetSupportedSimdLevel() {
+    static const SimdLevel supportedLevel = DetectSimdLevel();
+    return supportedLevel;
+}
+
+SimdLevel GetSimdLevel() {
+    return ActiveSimdLevel().load(std::memory_order_relaxed);
+}
+
+void SetSimdLevel(SimdLevel level) {
+    ActiveSimdLevel().store(std::min(level, GetSupportedSimdLevel()), std::memory_order_relaxed);
+}
+
+#ifdef BIGINT_SIMD_X86
+/* Vectorized Schoolbook Overview:
+*   - Each vector holds the sums of a run of consecutive result columns, one column per lane. The run starting
+*     at column k0 takes a[i] times the chunks b[k0 - i] onwards for every i, which is one broadcast of a[i]
+*     and one load of consecutive chunks of b, so the products need no shuffles and the lanes are never added
+*     together. b is copied with a run of zeros on both sides, so that loads past its ends add nothing.
+*   - Once a run of columns is summed, its carries are propagated by scalar code and its chunks written out
+*     before the next run is started, so no buffer of column sums is ever built.
+*/
+namespace {
+    const size_t PADDING = 8;
+}
+
+#ifdef BIGINT_BINARY_LIMBS
+/* IFMA Multiplication Overview:
+*   - vpmadd52luq and vpmadd52huq multiply the low 52 bits of two 64-bit lanes and add the low or the high
+*     52 bits of the 104-bit product to a third lane. With both operands cut into 52-bit digits, the
+*     product of digits i and j adds its low half to column i + j and its high half to column i + j + 1.
+*   - The column sums are carried in radix 2^52 and the digits packed back into 64-bit chunks.
+*/
+namespace {
+    const size_t DIGIT_BITS = 52;
+    const uint64_t DIGIT_MASK = ((uint64_t)1 << DIGIT_BITS) - 1;
+    const size_t SIMD_MULTIPLY_MAX_DIGITS = (SIMD_MULTIPLY_MAX_CHUNKS * 64 + DIGIT_BITS - 1) / DIGIT_BITS;
+
+    size_t DigitCount(size_t numSize) {
+        return (numSize * 64 + DIGIT_BITS - 1) / DIGIT_BITS;
+    }
+
+    // Cuts num into its DigitCount(numSize) 52-bit digits
+    void ToDigits(const Limb* num, size_t numSize, uint64_t* digits) {
+        size_t digitCount = DigitCount(numSize);
+        for (size_t d = 0; d < digitCount; d++) {
+            size_t bit = d * DIGIT_BITS;
+            size_t word = bit / 64;
+            size_t offset = bit % 64;
+            uint64_t value = num[word] >> offset;
+            if (offset > 64 - DIGIT_BITS && word + 1 < numSize) {
+                value |= num[word + 1] << (64 - offset);
+            }
+            digits[d] = value & DIGIT_MASK;
+        }
+    }
+
+    // Carries the digit columns into 52-bit digits and packs them into the chunks of result
+    struct DigitPacker {
+        Limb* result;
+        size_t resultSize;
+        size_t written = 0;
+        unsigned __int128 pending = 0;
+        size_t pendingBits = 0;
+        uint64_t carry = 0;
+
+        // The digits past the last chunk of the product are all zero
+        void AddColumn(uint64_t column) {
+            if (written == resultSize) {
+                return;
+            }
+            column += carry;
+            carry = column >> DIGIT_BITS;
+            pending |= (unsigned __int128)(column & DIGIT_MASK) << pendingBits;
+            pendingBits += DIGIT_BITS;
+            if (pendingBits >= 64) {
+                result[written++] = (Limb)pending;
+                pending >>= 64;
+                pendingBits -= 64;
+            }
+        }
+
+        void Finish() {
+            pending |= (unsigned __int128)carry << pendingBits;
+            while (written < resultSize) {
+                result[written++] = (Limb)pending;
+                pending >>= 64;
+            }
+        }
+    };
+
+    __attribute__((target("avx512f,avx512ifma")))
+    void MultiplyDigitsIfma(const uint64_t* aDigits, size_t aCount, const uint64_t* bPadded, size_t bCount,
+        DigitPacker& packer) {
+        uint64_t previousHigh = 0;
+        for (size_t k0 = 0; k0 < aCount + bCount; k0 += 8) {
+            __m512i low = _mm512_setzero_si512();
+            __m512i high = _mm512_setzero_si512();
+            size_t iStart = (k0 < bCount) ? 0 : k0 - bCount + 1;
+            size_t iEnd = std::min(k0 + 8, aCount);
+            for (size_t i = iStart; i < iEnd; i++) {
+                __m512i x = _mm512_set1_epi64((long long)aDigits[i]);
+                __m512i y = _mm512_loadu_si512(bPadded + PADDING + k0 - i);
+                low = _mm512_madd52lo_epu64(low, x, y);
+                high = _mm512_madd52hi_epu64(high, x, y);
+            }
+            alignas(64) uint64_t lows[8];
+            alignas(64) uint64_t highs[8];
+            _mm512_store_si512(lows, low);
+            _mm512_store_si512(highs, high);
+
+            // Column k holds the low halves of its own products and the high halves of those of column k - 1
+            for (size_t lane = 0; lane < 8; lane++) {
+                packer.AddColumn(lows[lane] + previousHigh);
+                previousHigh = highs[lane];
+            }
+        }
+        packer.AddColumn(previousHigh);
+    }
+}
+
+bool SimdMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result) {
+    if (aSize < bSize) {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+    if (GetSimdLevel() < SIMD_MULTIPLY_LEVEL || bSize == 0 || bSize > SIMD_MULTIPLY_MAX_CHUNKS) {
+        return false;
+    }
+
+    // Only the digits of a longer operand than b can go beyond the stack buffer
+    size_t aCount = DigitCount(aSize);
+    size_t bCount = DigitCount(bSize);
+    uint64_t aStackDigits[SIMD_MULTIPLY_MAX_DIGITS];
+    LimbVector aLongDigits;
+    uint64_t* aDigits = aStackDigits;
+    if (aCount > SIMD_MULTIPLY_MAX_DIGITS) {
+        aLongDigits.resize(aCount);
+        aDigits = aLongDigits.data();
+    }
+    uint64_t bPadded[SIMD_MULTIPLY_MAX_DIGITS + 2 * PADDING] = {};
+    ToDigits(a, aSize, aDigits);
+    ToDigits(b, bSize, bPadded + PADDING);
+
+    DigitPacker packer;
+    packer.result = result;
+    packer.resultSize = aSize + bSize;
+    MultiplyDigitsIfma(aDigits, aCount, bPadded, bCount, packer);
+    packer.Finish();
+    return true;
+}
+#else
+/* In decimal mode a chunk product is below 10^18 and only 17 of them fit in a 64-bit lane. Every 17 products
+*  the lanes are split, the bits above the low 32 being added to a second vector that counts units of 2^32,
+*  so dividing by the base is left to the scalar code that carries the finished columns.
+*/
+namespace {
+    const size_t PRODUCTS_PER_SPLIT = 17;
+    const uint64_t LOW_MASK = 0xFFFFFFFF;
+
+    // Carries the columns whose sums are highs[lane] * 2^32 + lows[lane] into the chunks of result
+    struct ColumnCarrier {
+        Limb* result;
+        size_t resultSize;
+        size_t written = 0;
+        WideLimb carry = 0;
+
+        void AddColumns(const uint64_t* lows, const uint64_t* highs, size_t width) {
+            for (size_t lane = 0; lane < width && written + 1 < resultSize; lane++) {
+                // 2^32 * high is split as 2^32 * (quotient * LIMB_BASE + remainder) to keep every term in 64 bits
+                WideLimb quotient = highs[lane] / LIMB_BASE;
+                WideLimb value = ((highs[lane] % LIMB_BASE) << 32) + lows[lane] + carry;
+                result[written++] = (Limb)(value % LIMB_BASE);
+                carry = (quotient << 32) + value / LIMB_BASE;
+            }
+        }
+
+        void Finish() {
+            result[written++] = (Limb)carry;
+        }
+    };
+
+    __attribute__((target("avx2")))
+    void MultiplyAvx2(const Limb* a, size_t aSize, const uint64_t* bPadded, size_t bSize, ColumnCarrier& carrier) {
+        const __m256i lowMask = _mm256_set1_epi64x((long long)LOW_MASK);
+        for (size_t k0 = 0; k0 + 1 < aSize + bSize; k0 += 4) {
+            __m256i sums = _mm256_setzero_si256();
+            __m256i highs = _mm256_setzero_si256();
+            size_t i = (k0 < bSize) ? 0 : k0 - bSize + 1;
+            size_t iEnd = std::min(k0 + 4, aSize);
+            while (i < iEnd) {
+                size_t splitEnd = std::min(i + PRODUCTS_PER_SPLIT, iEnd);
+                for (; i < splitEnd; i++) {
+                    __m256i x = _mm256_set1_epi32((int)a[i]);
+                    __m256i y = _mm256_loadu_si256((const __m256i*)(bPadded + PADDING + k0 - i));
+                    sums = _mm256_add_epi64(sums, _mm256_mul_epu32(x, y));
+                }
+                highs = _mm256_add_epi64(highs, _mm256_srli_epi64(sums, 32));
+                sums = _mm256_and_si256(sums, lowMask);
+            }
+            alignas(32) uint64_t lanes[4];
+            alignas(32) uint64_t laneHighs[4];
+            _mm256_store_si256((__m256i*)lanes, sums);
+            _mm256_store_si256((__m256i*)laneHighs, highs);
+            carrier.AddColumns(lanes, laneHighs, 4);
+        }
+    }
+
+    // The zero-masked forms of the multiply and the shift, with every lane selected, are the same instructions as the
+    // plain ones, whose undefined pass-through operand GCC reports as uninitialized
+    __attribute__((target("avx512f")))
+    void MultiplyAvx512(const Limb* a, size_t aSize, const uint64_t* bPadded, size_t bSize, ColumnCarrier& carrier) {
+        const __mmask8 allLanes = 0xFF;
+        const __m512i lowMask = _mm512_set1_epi64((long long)LOW_MASK);
+        for (size_t k0 = 0; k0 + 1 < aSize + bSize; k0 += 8) {
+            __m512i sums = _mm512_setzero_si512();
+            __m512i highs = _mm512_setzero_si512();
+            size_t i = (k0 < bSize) ? 0 : k0 - bSize + 1;
+            size_t iEnd = std::min(k0 + 8, aSize);
+            while (i < iEnd) {
+                size_t splitEnd = std::min(i + PRODUCTS_PER_SPLIT, iEnd);
+                for (; i < splitEnd; i++) {
+                    __m512i x = _mm512_set1_epi32((int)a[i]);
+                    __m512i y = _mm512_loadu_si512(bPadded + PADDING + k0 - i);
+                    sums = _mm512_add_epi64(sums, _mm512_maskz_mul_epu32(allLanes, x, y));
+                }
+                highs = _mm512_add_epi64(highs, _mm512_maskz_srli_epi64(allLanes, sums, 32));
+                sums = _mm512_and_si512(sums, lowMask);
+            }
+            alignas(64) uint64_t lanes[8];
+            alignas(64) uint64_t laneHighs[8];
+            _mm512_store_si512(lanes, sums);
+            _mm512_store_si512(laneHighs, highs);
+            carrier.AddColumns(lanes, laneHighs, 8);
+        }
+    }
+}
+
+bool SimdMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result) {
+    SimdLevel level = GetSimdLevel();
+    if (aSize < bSize) {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+    if (level < SIMD_MULTIPLY_LEVEL || bSize == 0 || bSize > SIMD_MULTIPLY_MAX_CHUNKS) {
+        return false;
+    }
+
+    // The shorter operand is the one loaded in runs, widened to one chunk per 64-bit lane
+    uint64_t bPadded[SIMD_MULTIPLY_MAX_CHUNKS + 2 * PADDING] = {};
+    std::copy(b, b + bSize, bPadded + PADDING);
+
+    ColumnCarrier carrier;
+    carrier.result = result;
+    carrier.resultSize = aSize + bSize;
+    if (level >= SimdLevel::Avx512) {
+        MultiplyAvx512(a, aSize, bPadded, bSize, carrier);
+    }
+    else {
+        MultiplyAvx2(a, aSize, bPadded, bSize, carrier);
+    }
+    carrier.Finish();
+    return true;
+}
+#endif
+#else
+bool SimdMultiply(const Limb*, size_t, const Limb*, size_t, Limb*) {
+    return false;
+}
+#endif
+
+}
@@ -0,0 +1,56 @@
+/***************************************************************************************************
+* Module Name: BigInt SIMD Kernels Definition
+*
+* Date: October, 2026
+*
+* Module Description:
+*	The BigInt SIMD header provides the interface definition for the vectorized versions of the
+*	schoolbook kernels, and for the runtime detection that picks between them. The instruction set
+*	is chosen with CPUID when the program starts, so a single binary built without any -m flags runs
+*	the fastest version every host supports.
+*
+* Notes:
+*   - In decimal mode the column sums of the schoolbook kernels are vectorized with AVX2 or AVX-512,
+*	  four or eight 32x32-bit chunk products per instruction.
+*   - In binary mode the chunks are 64 bits wide, which no vector instruction multiplies in full. With
+*	  AVX-512 IFMA the operands are instead re-cut into 52-bit digits, whose 104-bit products are summed
+*	  as separate low and high halves, and the result is packed back into 64-bit chunks.
+*   - The carry chains of addition and of multiplication by a single word run strictly from one chunk
+*	  to the next, which vector instructions cannot shorten, so those kernels stay scalar.
+*   - Every function here returns false when the level in use cannot handle the call, and the caller
+*	  then falls back to its scalar code. On hosts other than x86-64 the level is always Scalar.
+*
+***************************************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include "BigIntKernels.hpp"
+
+namespace BigIntKernels {
+	// Instruction set levels the kernels can use, from the least to the most capable
+	enum class SimdLevel {
+		Scalar,
+		Avx2,
+		Avx512,
+		Avx512Ifma
+	};
+
+	// The level the host supports is detected once. The level in use starts out the same and can be lowered,
+	// for instance to compare the vectorized kernels against the scalar ones, but never raised past it.
+	SimdLevel GetSupportedSimdLevel();
+	SimdLevel GetSimdLevel();
+	void SetSimdLevel(SimdLevel level);
+
+	// Lowest level at which SimdMultiply runs
+#ifdef BIGINT_BINARY_LIMBS
+	const SimdLevel SIMD_MULTIPLY_LEVEL = SimdLevel::Avx512Ifma;
+#else
+	const SimdLevel SIMD_MULTIPLY_LEVEL = SimdLevel::Avx2;
+#endif
+
+	// Longest shorter operand handled by SimdMultiply, which copies it to the stack
+	const size_t SIMD_MULTIPLY_MAX_CHUNKS = 256;
+
+	// Writes the aSize + bSize chunks of a * b to result with the vectorized schoolbook kernel of the level in use
+	bool SimdMultiply(const Limb* a, size_t aSize, const Limb* b, size_t bSize, Limb* result);
+}
@@ -22,6 +22,7 @@
 
 #include "BigInt.hpp"
 #include "doctest.h"
+#include <sstream>
 
 TEST_CASE("BigInt Default Constructor initializes to zero...") {
     BigInt bigInt;
@@ -30,19 +31,148 @@ TEST_CASE("BigInt Default Constructor initializes to zero...") {
     REQUIRE(bigInt.GetBigIntVectoredChunks()[0] == 0);
 }
 
+// The chunk layout below is that of the default base 10^9 chunks
+#ifndef BIGINT_BINARY_LIMBS
 TEST_CASE("BigInt Constructor initializes from string...") {
-    BigInt bigInt("12345");
-    REQUIRE(bigInt.GetBigIntFullString() == "12345");
+    BigInt bigInt("1234567890123");
+    REQUIRE(bigInt.GetBigIntFullString() == "1234567890123");
     REQUIRE(bigInt.GetBigIntVectoredChunks().size() == 2);
-    REQUIRE(bigInt.GetBigIntVectoredChunks()[0] == 12);
-    REQUIRE(bigInt.GetBigIntVectoredChunks()[1] == 345);
+    REQUIRE(bigInt.GetBigIntVectoredChunks()[0] == 567890123);
+    REQUIRE(bigInt.GetBigIntVectoredChunks()[1] == 1234);
 }
 
 TEST_CASE("BigInt Constructor initializes from vector...") {
-    std::vector<int> vec = { 12, 345 };
+    std::vector<uint32_t> vec = { 567890123, 1234 };
     BigInt bigInt(vec);
-    REQUIRE(bigInt.GetBigIntFullString() == "12345");
-    REQUIRE(bigInt.GetBigIntVectoredChunks() == vec);
+    REQUIRE(bigInt.GetBigIntFullString() == "1234567890123");
+    std::span<const BigInt::Limb> chunks = bigInt.GetBigIntVectoredChunks();
+    REQUIRE(std::vector<BigInt::Limb>(chunks.begin(), chunks.end()) == vec);
+}
+
+TEST_CASE("BigInt Constructor from vector pads inner chunks with zeros...") {
+    std::vector<uint32_t> vec = { 5, 1, 1 };
+    BigInt bigInt(vec);
+    REQUIRE(bigInt.GetBigIntFullString() == "1000000001000000005");
+}
+#endif
+
+TEST_CASE("BigInt Constructor moves a temporary vector and the accessors return references...") {
+    // Longer than the inline storage, so the vector's own buffer is adopted
+    BigInt::LimbVector vec(ChunkBuffer::INLINE_CAPACITY + 4, 1);
+    const BigInt::Limb* chunkData = vec.data();
+    BigInt bigInt(std::move(vec));
+    REQUIRE(bigInt.GetBigIntVectoredChunks().data() == chunkData);
+    REQUIRE(&bigInt.GetBigIntFullString() == &bigInt.GetBigIntFullString());
+
+    std::string_view numView = "-123456789012345678901234567890";
+    REQUIRE(BigInt(numView.substr(1)).GetBigIntFullString() == "123456789012345678901234567890");
+    REQUIRE(BigInt(numView).IsNegative());
+}
+
+TEST_CASE("BigInt ChunkBuffer keeps short values inline and spills long ones to the heap...") {
+    ChunkBuffer buffer;
+    for (size_t i = 0; i < ChunkBuffer::INLINE_CAPACITY; i++) {
+        buffer.push_back((BigInt::Limb)(i + 1));
+    }
+    REQUIRE(buffer.IsInline());
+    buffer.push_back(100);
+    REQUIRE(!buffer.IsInline());
+    REQUIRE(buffer.size() == ChunkBuffer::INLINE_CAPACITY + 1);
+    for (size_t i = 0; i < ChunkBuffer::INLINE_CAPACITY; i++) {
+        REQUIRE(buffer[i] == (BigInt::Limb)(i + 1));
+    }
+    REQUIRE(buffer.back() == 100);
+
+    ChunkBuffer copy = buffer;
+    copy.resize(2);
+    REQUIRE(copy.size() == 2);
+    REQUIRE(buffer.size() == ChunkBuffer::INLINE_CAPACITY + 1);
+    BigInt::LimbVector scratch;
+    REQUIRE(copy.AsVector(scratch) == BigInt::LimbVector{ 1, 2 });
+
+    ChunkBuffer shortBuffer(BigInt::LimbVector{ 7, 8 });
+    REQUIRE(shortBuffer.IsInline());
+    shortBuffer.resize(ChunkBuffer::INLINE_CAPACITY + 1, 9);
+    REQUIRE(!shortBuffer.IsInline());
+    REQUIRE(shortBuffer[1] == 8);
+    REQUIRE(shortBuffer.back() == 9);
+}
+
+TEST_CASE("BigInt small values keep their chunks inside the object through every operation...") {
+    auto isStoredInline = [](const BigInt& value) {
+        const char* chunkData = (const char*)value.GetBigIntVectoredChunks().data();
+        return chunkData >= (const char*)&value && chunkData < (const char*)&value + sizeof(BigInt);
+    };
+    BigInt A("99999");
+    BigInt B("-12345678901234567");
+    REQUIRE(isStoredInline(A));
+    REQUIRE(isStoredInline(B));
+    REQUIRE(isStoredInline(A * B));
+    REQUIRE(isStoredInline(A + B));
+    REQUIRE(isStoredInline(A - B));
+    REQUIRE(isStoredInline(B / A));
+    REQUIRE(isStoredInline(B % A));
+    REQUIRE(isStoredInline(A.square()));
+    REQUIRE(isStoredInline(A * 1000000007 + 3));
+    REQUIRE((A * B).GetBigIntFullString() == "-1234555544444555465433");
+    REQUIRE((B / A).GetBigIntFullString() == "-123458023592");
+    REQUIRE((B % A).GetBigIntFullString() == "-58159");
+    BigInt C("-123456789012345678901234567890123");
+    BigInt D("98765432109876543210987");
+    REQUIRE(isStoredInline(C / D));
+    REQUIRE(isStoredInline(C % D));
+    REQUIRE((C / D).GetBigIntFullString() == "-1249999988");
+    REQUIRE((C % D).GetBigIntFullString() == "-60185185206019336421967");
+    REQUIRE((D / C).GetBigIntFullString() == "0");
+    REQUIRE((D % C).GetBigIntFullString() == "98765432109876543210987");
+    REQUIRE(!isStoredInline(BigInt("99999").powerOf(1000)));
+}
+
+TEST_CASE("BigInt vector constructors trim leading zero chunks before dividing...") {
+    BigInt untrimmedDivisor(std::vector<BigInt::Limb>{ 5, 0 });
+    REQUIRE(untrimmedDivisor.GetBigIntVectoredChunks().size() == 1);
+    REQUIRE((BigInt("100") / untrimmedDivisor).GetBigIntFullString() == "20");
+    REQUIRE((BigInt("103") % untrimmedDivisor).GetBigIntFullString() == "3");
+    BigInt untrimmedLong(BigInt::LimbVector{ 7, 3, 0, 0 });
+    BigInt trimmedLong(BigInt::LimbVector{ 7, 3 });
+    BigInt dividend("123456789012345678901234567890123");
+    REQUIRE(dividend / untrimmedLong == dividend / trimmedLong);
+    REQUIRE(dividend % untrimmedLong == dividend % trimmedLong);
+    REQUIRE(!BigInt(BigInt::LimbVector{ 0, 0 }, true).IsNegative());
+}
+
+TEST_CASE("BigInt operators on temporaries match the same operators on named values...") {
+    BigInt A("123456789012345678901234567890");
+    BigInt B("-98765432109876543210");
+    BigInt product = A * B;
+    REQUIRE(A * B + A == product + A);
+    REQUIRE(A * B - A == product - A);
+    REQUIRE(A * B * 7 == product * 7);
+    REQUIRE(A * B + 7 == product + 7);
+    REQUIRE((-(A * B)).GetBigIntFullString() == (-product).GetBigIntFullString());
+    REQUIRE((-BigInt("-5")).GetBigIntFullString() == "5");
+    REQUIRE((-BigInt("5")).GetBigIntFullString() == "-5");
+    REQUIRE((-BigInt("0")).GetBigIntFullString() == "0");
+    REQUIRE((-(A * B)) == -product);
+}
+
+TEST_CASE("BigInt Constructor round-trips a string through its chunks...") {
+    std::string numStr = "18446744073709551616000000000123456789";
+    BigInt bigInt(numStr);
+    std::span<const BigInt::Limb> chunks = bigInt.GetBigIntVectoredChunks();
+    std::vector<BigInt::Limb> vec(chunks.begin(), chunks.end());
+    BigInt copy(vec);
+    REQUIRE(bigInt.GetBigIntFullString() == numStr);
+    REQUIRE(copy.GetBigIntFullString() == numStr);
+}
+
+TEST_CASE("BigInt builds the string of a product only when it is asked for...") {
+    const BigInt A("123456789123456789");
+    const BigInt C = A * A;
+    std::ostringstream printed;
+    printed << C;
+    REQUIRE(printed.str().find("15241578780673678515622620750190521") != std::string::npos);
+    REQUIRE(C.GetBigIntFullString() == "15241578780673678515622620750190521");
 }
 
 TEST_CASE("BigInt A * B with A = B = 123, 123 * 123...") {
@@ -52,6 +182,193 @@ TEST_CASE("BigInt A * B with A = B = 123, 123 * 123...") {
     REQUIRE(C.GetBigIntFullString() == "15129");
 }
 
+TEST_CASE("BigInt multiplication and addition with native integers...") {
+    BigInt A("999999999999999999999999999999");
+    REQUIRE((A * 7u).GetBigIntFullString() == "6999999999999999999999999999993");
+    REQUIRE((A * 18446744073709551615u).GetBigIntFullString() == "18446744073709551614999999999981553255926290448385");
+    REQUIRE((A * 0u).GetBigIntFullString() == "0");
+    REQUIRE((A + 1u).GetBigIntFullString() == "1000000000000000000000000000000");
+    REQUIRE((A + 18446744073709551615u).GetBigIntFullString() == "1000000000018446744073709551614");
+
+    BigInt factorial("1");
+    for (uint64_t i = 2; i <= 30; i++) {
+        factorial *= i;
+    }
+    factorial += 1;
+    REQUIRE(factorial.GetBigIntFullString() == "265252859812191058636308480000001");
+}
+
+TEST_CASE("BigInt addition and subtraction carry and borrow across chunks...") {
+    BigInt A("999999999999999999999999999999");
+    BigInt B("1");
+    REQUIRE((A + B).GetBigIntFullString() == "1000000000000000000000000000000");
+    REQUIRE(((A + B) - B).GetBigIntFullString() == "999999999999999999999999999999");
+    REQUIRE((A - A).GetBigIntFullString() == "0");
+
+    BigInt C("18446744073709551616");
+    C += C;
+    REQUIRE(C.GetBigIntFullString() == "36893488147419103232");
+    C -= BigInt("36893488147419103231");
+    REQUIRE(C.GetBigIntFullString() == "1");
+    REQUIRE((B - A).GetBigIntFullString() == "-999999999999999999999999999998");
+}
+
+TEST_CASE("BigInt signed values through construction, arithmetic and formatting...") {
+    BigInt A("-123456789012345678901234567890");
+    BigInt B("1000000000000000000000");
+    REQUIRE(A.IsNegative());
+    REQUIRE(A.GetBigIntFullString() == "-123456789012345678901234567890");
+    REQUIRE((A * B).GetBigIntFullString() == "-123456789012345678901234567890000000000000000000000");
+    REQUIRE((A * A).GetBigIntFullString() == "15241578753238836750495351562536198787501905199875019052100");
+    REQUIRE((A + B).GetBigIntFullString() == "-123456788012345678901234567890");
+    REQUIRE((B - A).GetBigIntFullString() == "123456790012345678901234567890");
+    REQUIRE((A - A).GetBigIntFullString() == "0");
+    REQUIRE(!(A - A).IsNegative());
+    REQUIRE((-A).GetBigIntFullString() == "123456789012345678901234567890");
+    REQUIRE(BigInt("-7").powerOf(3).GetBigIntFullString() == "-343");
+    REQUIRE(BigInt("-7").powerOf(4).GetBigIntFullString() == "2401");
+    REQUIRE((BigInt("-5") + 3u).GetBigIntFullString() == "-2");
+    REQUIRE((BigInt("-5") * 0u).GetBigIntFullString() == "0");
+    REQUIRE((BigInt("-5") * -3).GetBigIntFullString() == "15");
+    REQUIRE((BigInt("-5") + -3).GetBigIntFullString() == "-8");
+    REQUIRE((BigInt("-5") + (int64_t)7).GetBigIntFullString() == "2");
+    REQUIRE((A * (int64_t)-1).GetBigIntFullString() == "123456789012345678901234567890");
+    REQUIRE((A * INT64_MIN).GetBigIntFullString() == "1138687895536349070124195419011280854005705605120");
+    REQUIRE((BigInt("-5") * -0).GetBigIntFullString() == "0");
+    REQUIRE(!(BigInt("-5") * -0).IsNegative());
+    BigInt C("-100");
+    C += -5;
+    REQUIRE(C.GetBigIntFullString() == "-105");
+    C *= -2;
+    REQUIRE(C.GetBigIntFullString() == "210");
+    C += (long long)-210;
+    REQUIRE(C.GetBigIntFullString() == "0");
+    REQUIRE(!C.IsNegative());
+    REQUIRE(A < B);
+    REQUIRE(A < BigInt("-123456789012345678901234567889"));
+    REQUIRE(BigInt("-0") == BigInt("0"));
+    REQUIRE(BigInt("-0").GetBigIntFullString() == "0");
+    REQUIRE(BigInt("-000").GetBigIntFullString() == "0");
+    REQUIRE(BigInt("-00042").GetBigIntFullString() == "-42");
+    REQUIRE(BigInt("0007").GetBigIntFullString() == "7");
+    REQUIRE_THROWS_AS(BigInt("-"), std::invalid_argument);
+}
+
+TEST_CASE("BigInt comparison operators...") {
+    BigInt A("123456789012345678901234567890");
+    BigInt B("123456789012345678901234567891");
+    REQUIRE(A < B);
+    REQUIRE(B > A);
+    REQUIRE(A <= A);
+    REQUIRE(A != B);
+    REQUIRE(A == BigInt("123456789012345678901234567890"));
+    REQUIRE((BigInt("99") <=> BigInt("100")) == std::strong_ordering::less);
+    REQUIRE((BigInt("0") <=> BigInt()) == std::strong_ordering::equal);
+}
+
+TEST_CASE("BigInt division and modulo truncate toward zero...") {
+    BigInt A("123456789012345678901234567890123456789");
+    BigInt B("987654321987654321");
+    REQUIRE((A / B).GetBigIntFullString() == "124999998748437501153");
+    REQUIRE((A % B).GetBigIntFullString() == "142745764920524676");
+    REQUIRE(((-A) / B).GetBigIntFullString() == "-124999998748437501153");
+    REQUIRE(((-A) % B).GetBigIntFullString() == "-142745764920524676");
+    REQUIRE((A / (-B)).GetBigIntFullString() == "-124999998748437501153");
+    REQUIRE((B / A).GetBigIntFullString() == "0");
+    REQUIRE((B % A).GetBigIntFullString() == "987654321987654321");
+    REQUIRE_THROWS_AS(A / BigInt("0"), std::invalid_argument);
+}
+
+TEST_CASE("BigInt division matches multiplication at every algorithm tier...") {
+    size_t originalBurnikelZieglerThreshold = BigInt::GetBurnikelZieglerThreshold();
+    size_t originalNewtonDivisionThreshold = BigInt::GetNewtonDivisionThreshold();
+    BigInt divisor = BigInt("7").powerOf(2000) + BigInt("123456789");
+    BigInt quotient = BigInt("3").powerOf(5000) + BigInt("1");
+    BigInt remainder = BigInt("5").powerOf(1500);
+    BigInt dividend = divisor * quotient + remainder;
+    for (size_t burnikelZieglerThreshold : { (size_t)1000000, (size_t)8 }) {
+        for (size_t newtonDivisionThreshold : { (size_t)1000000, (size_t)20 }) {
+            BigInt::SetBurnikelZieglerThreshold(burnikelZieglerThreshold);
+            BigInt::SetNewtonDivisionThreshold(newtonDivisionThreshold);
+            std::pair<BigInt, BigInt> result = dividend.divmod(divisor);
+            REQUIRE(result.first == quotient);
+            REQUIRE(result.second == remainder);
+        }
+    }
+    BigInt::SetBurnikelZieglerThreshold(originalBurnikelZieglerThreshold);
+    BigInt::SetNewtonDivisionThreshold(originalNewtonDivisionThreshold);
+}
+
+TEST_CASE("BigInt powMod matches powerOf reduced by the modulus...") {
+    BigInt A("123456789123456789");
+    BigInt exponent("1000");
+    BigInt fullPower = A.powerOf(1000);
+    for (std::string modulusStr : { "1000000000000000000000000000057", "1000000000000000000000000000000",
+        "98765432109876543210987654321098765432105", "18446744073709551616" }) {
+        BigInt modulus(modulusStr);
+        REQUIRE(A.powMod(exponent, modulus) == fullPower % modulus);
+    }
+}
+
+TEST_CASE("BigInt powMod edge cases...") {
+    REQUIRE(BigInt("4").powMod(BigInt("13"), BigInt("497")).GetBigIntFullString() == "445");
+    REQUIRE(BigInt("-4").powMod(BigInt("13"), BigInt("497")).GetBigIntFullString() == "52");
+    REQUIRE(BigInt("5").powMod(BigInt("0"), BigInt("7")).GetBigIntFullString() == "1");
+    REQUIRE(BigInt("5").powMod(BigInt("0"), BigInt("1")).GetBigIntFullString() == "0");
+    REQUIRE(BigInt("14").powMod(BigInt("3"), BigInt("7")).GetBigIntFullString() == "0");
+    REQUIRE_THROWS_AS(BigInt("5").powMod(BigInt("3"), BigInt("0")), std::invalid_argument);
+    REQUIRE_THROWS_AS(BigInt("5").powMod(BigInt("-3"), BigInt("7")), std::invalid_argument);
+}
+
+TEST_CASE("BigInt powerOf matches repeated multiplication for bases at the edges of a chunk...") {
+    for (std::string baseStr : { "0", "1", "999999999", "1000000000", "18446744073709551615", "18446744073709551616" }) {
+        BigInt A(baseStr);
+        BigInt expected("1");
+        for (int exponent = 1; exponent <= 70; exponent++) {
+            expected = expected * A;
+            REQUIRE(A.powerOf(exponent) == expected);
+        }
+    }
+}
+
+TEST_CASE("BigInt powerDigitCount and powerLeadingDigits match the full power...") {
+    for (std::string baseStr : { "123", "-7", "99999", "1000", "999999999999999999999", "12345678901234567890123" }) {
+        BigInt A(baseStr);
+        for (int exponent : { 0, 1, 2, 13, 321, 1000 }) {
+            std::string fullStr = A.powerOf(exponent).GetBigIntFullString();
+            if (fullStr[0] == '-') {
+                fullStr.erase(fullStr.begin());
+            }
+            REQUIRE(A.powerDigitCount(exponent) == fullStr.size());
+            for (size_t digitCount : { 1, 5, 40 }) {
+                REQUIRE(A.powerLeadingDigits(exponent, digitCount) == fullStr.substr(0, digitCount));
+                REQUIRE(A.powerDigitCountAndLeadingDigits(exponent, digitCount) == std::make_pair(fullStr.size(), fullStr.substr(0, digitCount)));
+            }
+        }
+    }
+}
+
+TEST_CASE("BigInt powerDigitCount counts digits exactly next to powers of ten and of two...") {
+    BigInt one("1");
+    for (int k = 1; k <= 60; k++) {
+        BigInt powerOfTen("1" + std::string(k, '0'));
+        BigInt powerOfTwo = BigInt("2").powerOf(4 * k);
+        for (const BigInt& A : { powerOfTen - one, powerOfTen, powerOfTen + one, powerOfTwo - one, powerOfTwo }) {
+            for (int exponent : { 1, 3 }) {
+                REQUIRE(A.powerDigitCount(exponent) == A.powerOf(exponent).GetBigIntFullString().size());
+            }
+        }
+    }
+}
+
+TEST_CASE("BigInt powerDigitCount and powerLeadingDigits handle zero bases and large powers...") {
+    REQUIRE(BigInt("0").powerDigitCount(0) == 1);
+    REQUIRE(BigInt("0").powerLeadingDigits(5, 3) == "0");
+    REQUIRE(BigInt("99999").powerDigitCount(99999) == 499995);
+    REQUIRE(BigInt("99999").powerLeadingDigits(99999, 20) == "36788128057937806481");
+    REQUIRE_THROWS_AS(BigInt("5").powerDigitCount(-1), std::invalid_argument);
+}
+
 TEST_CASE("BigInt C = A ^ 2 with A = 123, C = 123 ^ 2...") {
     BigInt A("123");
     BigInt result = A.powerOf(2);
@@ -67,4 +384,248 @@ TEST_CASE("BigInt C = A ^ B with B = rev(A) and A = 123, C = 123 ^ 321...") {
     REQUIRE(result.GetBigIntFullString() ==
         "72367033806371673149109894141163778628811792657571658906010558390395870363798401744095280686155507736404921657070284961721828960592977909542637098897697223102622628566787654091327825453991595140205701412961364188732408936197890553699715836951569999800431957769217006743321026257517932764164662319487914962533302741368207211189494615326552790667720411285474162636765168907211924134973374304496019635376665858559941735703924836467756917247995469583487467791524582153744522107597865277798136080074161485280424274076931083994487111719562249702540362855712911132265966235754355353516703339043001506118520760359577737869472018617942120590873170710805078696371738906375721785723"
     );
+}
+
+TEST_CASE("BigInt powerOf handles the exponents 0 and 1 and rejects negative exponents...") {
+    BigInt A("98765432109876543210");
+    REQUIRE(A.powerOf(0).GetBigIntFullString() == "1");
+    REQUIRE(A.powerOf(1).GetBigIntFullString() == "98765432109876543210");
+    REQUIRE(BigInt("0").powerOf(5).GetBigIntFullString() == "0");
+    REQUIRE_THROWS_AS(A.powerOf(-1), std::invalid_argument);
+}
+
+TEST_CASE("BigInt powerOf matches repeated multiplication for multi-chunk bases...") {
+    BigInt A("12345678901234567890123456789");
+    BigInt expected("1");
+    for (int exponent = 1; exponent <= 600; exponent++) {
+        expected = expected * A;
+        if (exponent <= 40 || exponent == 517 || exponent == 600) {
+            REQUIRE(A.powerOf(exponent).GetBigIntFullString() == expected.GetBigIntFullString());
+        }
+    }
+}
+
+TEST_CASE("BigInt Karatsuba multiplication of 10^300 - 1 by itself...") {
+    size_t originalThreshold = BigInt::GetKaratsubaThreshold();
+    BigInt::SetKaratsubaThreshold(4);
+    BigInt A(std::string(300, '9'));
+    BigInt C = A * A;
+    BigInt::SetKaratsubaThreshold(originalThreshold);
+    REQUIRE(C.GetBigIntFullString() == std::string(299, '9') + "8" + std::string(299, '0') + "1");
+}
+
+TEST_CASE("BigInt schoolbook multiplication carries correctly when every chunk is at its maximum...") {
+    // LIMB_BASE^n - 1 has every chunk at LIMB_BASE - 1, which makes every column sum as large as it can be
+    size_t originalThreshold = BigInt::GetKaratsubaThreshold();
+    BigInt::SetKaratsubaThreshold(1000000);
+    BigInt chunkBase(BigInt::LimbVector{ 0, 1 });
+    BigInt one("1");
+    for (int n : { 1, 2, 16, 17, 18, 35, 120 }) {
+        BigInt basePower = chunkBase.powerOf(n);
+        BigInt allMax = basePower - one;
+        BigInt expectedSquare = basePower * basePower - basePower * 2 + one;
+        REQUIRE(allMax * allMax == expectedSquare);
+        REQUIRE(allMax.square() == expectedSquare);
+        BigInt shorter = chunkBase.powerOf(n / 2 + 1) - one;
+        REQUIRE(allMax * shorter == basePower * chunkBase.powerOf(n / 2 + 1) - basePower - chunkBase.powerOf(n / 2 + 1) + one);
+    }
+    BigInt::SetKaratsubaThreshold(originalThreshold);
+}
+
+TEST_CASE("BigInt vectorized schoolbook kernels match the scalar ones at every SIMD level the host supports...") {
+    // Operand sizes around the vector widths, on both sides of SIMD_MULTIPLY_MAX_CHUNKS and far apart from each other
+    size_t originalThreshold = BigInt::GetKaratsubaThreshold();
+    BigInt::SetKaratsubaThreshold(1000000);
+    std::vector<BigInt> operands;
+    for (int chunks : { 3, 8, 9, 17, 40, 64, 255, 256, 257, 600 }) {
+        std::string digits = "9";
+        for (int i = 1; i < chunks * CHUNK_SIZE_DEFAULT; i++) {
+            digits += std::to_string((i * 7 + chunks) % 10);
+        }
+        operands.push_back(BigInt(digits));
+    }
+
+    BigIntKernels::SetSimdLevel(BigIntKernels::SimdLevel::Scalar);
+    std::vector<BigInt> expected;
+    for (const BigInt& a : operands) {
+        for (const BigInt& b : operands) {
+            expected.push_back(a * b);
+        }
+        expected.push_back(a.square());
+    }
+    for (BigIntKernels::SimdLevel level : { BigIntKernels::SimdLevel::Avx2, BigIntKernels::SimdLevel::Avx512,
+        BigIntKernels::SimdLevel::Avx512Ifma }) {
+        BigIntKernels::SetSimdLevel(level);
+        if (BigIntKernels::GetSimdLevel() != level) {
+            continue;
+        }
+        size_t index = 0;
+        for (const BigInt& a : operands) {
+            for (const BigInt& b : operands) {
+                REQUIRE(a * b == expected[index++]);
+            }
+            REQUIRE(a.square() == expected[index++]);
+        }
+    }
+
+    // Asking for the highest level restores the one the host supports
+    BigIntKernels::SetSimdLevel(BigIntKernels::SimdLevel::Avx512Ifma);
+    REQUIRE(BigIntKernels::GetSimdLevel() == BigIntKernels::GetSupportedSimdLevel());
+    BigInt::SetKaratsubaThreshold(originalThreshold);
+}
+
+TEST_CASE("BigInt Karatsuba multiplication matches schoolbook for unbalanced operands...") {
+    std::string num1Str, num2Str;
+    for (int i = 0; i < 700; i++) {
+        num1Str += std::to_string((i * 7 + 3) % 10);
+    }
+    for (int i = 0; i < 250; i++) {
+        num2Str += std::to_string((i * 3 + 1) % 10);
+    }
+    BigInt A(num1Str);
+    BigInt B(num2Str);
+    size_t originalThreshold = BigInt::GetKaratsubaThreshold();
+    BigInt::SetKaratsubaThreshold(1000000);
+    BigInt schoolbookResult = A * B;
+    BigInt::SetKaratsubaThreshold(3);
+    BigInt karatsubaResult = A * B;
+    BigInt::SetKaratsubaThreshold(originalThreshold);
+    REQUIRE(karatsubaResult.GetBigIntFullString() == schoolbookResult.GetBigIntFullString());
+}
+
+TEST_CASE("BigInt Toom-3 and Toom-4 multiplication match schoolbook...") {
+    std::string num1Str, num2Str;
+    for (int i = 0; i < 900; i++) {
+        num1Str += std::to_string((i * 7 + 3) % 10);
+    }
+    for (int i = 0; i < 600; i++) {
+        num2Str += std::to_string((i * i + 9) % 10);
+    }
+    BigInt A(num1Str);
+    BigInt B(num2Str);
+    size_t originalKaratsubaThreshold = BigInt::GetKaratsubaThreshold();
+    size_t originalToom3Threshold = BigInt::GetToom3Threshold();
+    size_t originalToom4Threshold = BigInt::GetToom4Threshold();
+    BigInt::SetKaratsubaThreshold(1000000);
+    BigInt schoolbookResult = A * B;
+
+    // Toom-3 only, down to the smallest operands it accepts
+    BigInt::SetKaratsubaThreshold(4);
+    BigInt::SetToom3Threshold(9);
+    BigInt::SetToom4Threshold(1000000);
+    BigInt toom3Result = A * B;
+
+    // Toom-4 on top, with Toom-3 and Karatsuba below it
+    BigInt::SetToom3Threshold(12);
+    BigInt::SetToom4Threshold(40);
+    BigInt toom4Result = A * B;
+
+    BigInt::SetKaratsubaThreshold(originalKaratsubaThreshold);
+    BigInt::SetToom3Threshold(originalToom3Threshold);
+    BigInt::SetToom4Threshold(originalToom4Threshold);
+    REQUIRE(toom3Result.GetBigIntFullString() == schoolbookResult.GetBigIntFullString());
+    REQUIRE(toom4Result.GetBigIntFullString() == schoolbookResult.GetBigIntFullString());
+}
+
+TEST_CASE("BigInt Toom-4 multiplication of 10^900 - 1 by itself...") {
+    size_t originalToom3Threshold = BigInt::GetToom3Threshold();
+    size_t originalToom4Threshold = BigInt::GetToom4Threshold();
+    BigInt::SetToom3Threshold(16);
+    BigInt::SetToom4Threshold(16);
+    BigInt A(std::string(900, '9'));
+    BigInt C = A * A;
+    BigInt::SetToom3Threshold(originalToom3Threshold);
+    BigInt::SetToom4Threshold(originalToom4Threshold);
+    REQUIRE(C.GetBigIntFullString() == std::string(899, '9') + "8" + std::string(899, '0') + "1");
+}
+
+TEST_CASE("BigInt NTT multiplication matches schoolbook for unbalanced operands...") {
+    std::string num1Str, num2Str;
+    for (int i = 0; i < 1500; i++) {
+        num1Str += std::to_string((i * 7 + 3) % 10);
+    }
+    for (int i = 0; i < 100; i++) {
+        num2Str += std::to_string((i * i + 9) % 10);
+    }
+    BigInt A(num1Str);
+    BigInt B(num2Str);
+    size_t originalKaratsubaThreshold = BigInt::GetKaratsubaThreshold();
+    size_t originalNttThreshold = BigInt::GetNttThreshold();
+    BigInt::SetKaratsubaThreshold(1000000);
+    BigInt schoolbookResult = A * B;
+    BigInt::SetKaratsubaThreshold(4);
+    BigInt::SetNttThreshold(4);
+    BigInt nttResult = A * B;
+    BigInt::SetKaratsubaThreshold(originalKaratsubaThreshold);
+    BigInt::SetNttThreshold(originalNttThreshold);
+    REQUIRE(nttResult.GetBigIntFullString() == schoolbookResult.GetBigIntFullString());
+}
+
+TEST_CASE("BigInt NTT multiplication of 10^3000 - 1 by itself...") {
+    size_t originalNttThreshold = BigInt::GetNttThreshold();
+    BigInt::SetNttThreshold(32);
+    BigInt A(std::string(3000, '9'));
+    BigInt C = A * A;
+    BigInt::SetNttThreshold(originalNttThreshold);
+    REQUIRE(C.GetBigIntFullString() == std::string(2999, '9') + "8" + std::string(2999, '0') + "1");
+}
+
+TEST_CASE("BigInt square matches multiplication at every algorithm tier...") {
+    std::string numStr;
+    for (int i = 0; i < 1200; i++) {
+        numStr += std::to_string((i * 7 + 3) % 10);
+    }
+    BigInt A(numStr);
+    size_t originalKaratsubaThreshold = BigInt::GetKaratsubaThreshold();
+    size_t originalToom3Threshold = BigInt::GetToom3Threshold();
+    size_t originalToom4Threshold = BigInt::GetToom4Threshold();
+    size_t originalNttThreshold = BigInt::GetNttThreshold();
+    BigInt::SetKaratsubaThreshold(1000000);
+    BigInt::SetNttThreshold(1000000);
+    std::string expected = (A * A).GetBigIntFullString();
+    REQUIRE(A.square().GetBigIntFullString() == expected);
+
+    BigInt::SetKaratsubaThreshold(4);
+    REQUIRE(A.square().GetBigIntFullString() == expected);
+    BigInt::SetToom3Threshold(9);
+    REQUIRE(A.square().GetBigIntFullString() == expected);
+    BigInt::SetToom4Threshold(30);
+    REQUIRE(A.square().GetBigIntFullString() == expected);
+    BigInt::SetNttThreshold(100);
+    REQUIRE(A.square().GetBigIntFullString() == expected);
+
+    BigInt::SetKaratsubaThreshold(originalKaratsubaThreshold);
+    BigInt::SetToom3Threshold(originalToom3Threshold);
+    BigInt::SetToom4Threshold(originalToom4Threshold);
+    BigInt::SetNttThreshold(originalNttThreshold);
+}
+
+TEST_CASE("BigInt square of zero...") {
+    BigInt A("0");
+    REQUIRE(A.square().GetBigIntFullString() == "0");
+}
+
+TEST_CASE("BigInt Constructor parses long strings...") {
+    std::string numStr = "7";
+    for (int i = 0; i < 5000; i++) {
+        numStr += std::to_string((i * i + 3 * i) % 10);
+    }
+    BigInt A(numStr);
+    std::span<const BigInt::Limb> chunks = A.GetBigIntVectoredChunks();
+    std::vector<BigInt::Limb> vec(chunks.begin(), chunks.end());
+    BigInt copy(vec);
+    REQUIRE(copy.GetBigIntFullString() == numStr);
+}
+
+TEST_CASE("BigInt Constructor formats long runs of zero digits...") {
+    std::string numStr = "1" + std::string(4000, '0') + "1" + std::string(3000, '0');
+    BigInt A(numStr);
+    std::span<const BigInt::Limb> chunks = A.GetBigIntVectoredChunks();
+    std::vector<BigInt::Limb> vec(chunks.begin(), chunks.end());
+    BigInt copy(vec);
+    REQUIRE(copy.GetBigIntFullString() == numStr);
+}
+
+TEST_CASE("BigInt Constructor rejects non-digit characters...") {
+    REQUIRE_THROWS_AS(BigInt("12a45"), std::invalid_argument);
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+/***************************************************************************************************
+* Module Name: ChunkBuffer Class Definition
+*
+* Date: October, 2026
+*
+* Module Description:
+*	The ChunkBuffer header provides the chunk storage of the BigInt class. It holds up to
+*	INLINE_CAPACITY chunks inside the object itself and only moves them to the heap once a value
+*	grows past that, so creating, copying and combining small BigInts allocates nothing.
+*
+* Notes:
+*   - The inline capacity is 32 bytes of chunks: eight base 10^9 chunks (72 digits) in decimal mode
+*	  and four 64-bit chunks (256 bits) in binary mode.
+*   - Once spilled, the chunks live in a std::vector, so large values can still be handed to the
+*	  vector-based kernels, or adopted from their results, without a copy. A buffer does not move back
+*	  inline when its value shrinks again.
+*   - The interface is the subset of std::vector that BigInt needs. The functions are all small and
+*	  on the hot path of every operation, so they are defined here to be inlined.
+*
+***************************************************************************************************/
+
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include "BigIntKernels.hpp"
+
+class ChunkBuffer {
+public:
+	typedef BigIntKernels::Limb Limb;
+	typedef BigIntKernels::LimbVector LimbVector;
+	static const size_t INLINE_CAPACITY = 32 / sizeof(Limb);
+private:
+	Limb inlineChunks[INLINE_CAPACITY] = {};
+	size_t inlineSize = 0;
+	LimbVector heapChunks;
+	bool isInline = true;
+
+	// Moves the inline chunks to the heap, with room for at least newCapacity chunks
+	void spill(size_t newCapacity) {
+		heapChunks.reserve(std::max(newCapacity, 2 * INLINE_CAPACITY));
+		heapChunks.assign(inlineChunks, inlineChunks + inlineSize);
+		isInline = false;
+	}
+public:
+	ChunkBuffer() {}
+
+	// Adopts the storage of a vector with more than INLINE_CAPACITY chunks, and copies a shorter one inline
+	explicit ChunkBuffer(LimbVector&& chunks) {
+		if (chunks.size() <= INLINE_CAPACITY) {
+			std::copy(chunks.begin(), chunks.end(), inlineChunks);
+			inlineSize = chunks.size();
+		}
+		else {
+			heapChunks = std::move(chunks);
+			isInline = false;
+		}
+	}
+
+	size_t size() const { return isInline ? inlineSize : heapChunks.size(); }
+	bool empty() const { return size() == 0; }
+	Limb* data() { return isInline ? inlineChunks : heapChunks.data(); }
+	const Limb* data() const { return isInline ? inlineChunks : heapChunks.data(); }
+	Limb* begin() { return data(); }
+	Limb* end() { return data() + size(); }
+	const Limb* begin() const { return data(); }
+	const Limb* end() const { return data() + size(); }
+	Limb& operator[](size_t i) { return data()[i]; }
+	const Limb& operator[](size_t i) const { return data()[i]; }
+	Limb& back() { return data()[size() - 1]; }
+	const Limb& back() const { return data()[size() - 1]; }
+	bool IsInline() const { return isInline; }
+
+	void push_back(Limb chunk) {
+		if (isInline && inlineSize < INLINE_CAPACITY) {
+			inlineChunks[inlineSize++] = chunk;
+			return;
+		}
+		if (isInline) {
+			spill(inlineSize + 1);
+		}
+		heapChunks.push_back(chunk);
+	}
+
+	void pop_back() {
+		if (isInline) {
+			inlineSize--;
+		}
+		else {
+			heapChunks.pop_back();
+		}
+	}
+
+	// New chunks are set to value, as with std::vector::resize
+	void resize(size_t newSize, Limb value = 0) {
+		if (isInline && newSize <= INLINE_CAPACITY) {
+			if (newSize > inlineSize) {
+				std::fill(inlineChunks + inlineSize, inlineChunks + newSize, value);
+			}
+			inlineSize = newSize;
+			return;
+		}
+		if (isInline) {
+			spill(newSize);
+		}
+		heapChunks.resize(newSize, value);
+	}
+
+	void assign(const Limb* first, const Limb* last) {
+		resize(0);
+		resize((size_t)(last - first));
+		std::copy(first, last, data());
+	}
+
+	// Returns the chunks as a vector: the heap storage itself once spilled, or else a copy of the inline chunks
+	// made in scratch, which is at most INLINE_CAPACITY chunks long
+	const LimbVector& AsVector(LimbVector& scratch) const {
+		if (!isInline) {
+			return heapChunks;
+		}
+		scratch.assign(inlineChunks, inlineChunks + inlineSize);
+		return scratch;
+	}
+};
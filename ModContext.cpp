@@ -0,0 +1,74 @@
+/***************************************************************************************************
+* Module Name: ModContext Class Implementation
+*
+* Date: October, 2026
+*
+* Module Description:
+*	This module contains the implementation details of the ModContext class, which reduces values
+*	modulo a fixed modulus with Barrett's reduction against a reciprocal computed once.
+*
+* Notes:
+*   - The arithmetic itself lives in BigIntKernels: Reciprocal computes the reciprocal, BarrettReduce
+*	  uses it, and PowMod takes it so that the exponentiation does not compute its own.
+*   - The kernels only see magnitudes, and the sign of a reduced value is settled here by subtracting
+*	  a non-zero remainder from the modulus.
+*
+***************************************************************************************************/
+
+#include "ModContext.hpp"
+
+ModContext::ModContext(const BigInt& modulus) {
+    if (modulus.isNegative || BigIntKernels::Compare(modulus.bigIntVecChunks.data(), modulus.bigIntVecChunks.size(), nullptr, 0) == 0) {
+        throw std::invalid_argument("ModContext requires a positive modulus");
+    }
+    modulusChunks.assign(modulus.bigIntVecChunks.begin(), modulus.bigIntVecChunks.end());
+    config = modulus.GetMultiplyConfig();
+    reciprocal = BigIntKernels::Reciprocal(modulusChunks, config);
+}
+
+BigInt ModContext::GetModulus() const {
+    return BigInt(modulusChunks);
+}
+
+BigInt ModContext::reduceMagnitude(const BigInt::LimbVector& magnitude, bool isNegative) const {
+    BigInt::LimbVector remainder = BigIntKernels::BarrettReduce(magnitude, modulusChunks, reciprocal, config);
+
+    // -x mod M is M - (x mod M) unless x is a multiple of M
+    if (isNegative && !remainder.empty()) {
+        BigInt::LimbVector flipped = modulusChunks;
+        BigIntKernels::SubtractInPlace(flipped, remainder);
+        remainder.swap(flipped);
+    }
+    while (remainder.size() > 1 && remainder.back() == 0) {
+        remainder.pop_back();
+    }
+    if (remainder.empty()) {
+        remainder.push_back(0);
+    }
+    return BigInt(std::move(remainder));
+}
+
+BigInt ModContext::reduce(const BigInt& value) const {
+    BigInt::LimbVector scratch;
+    return reduceMagnitude(value.bigIntVecChunks.AsVector(scratch), value.isNegative);
+}
+
+BigInt ModContext::mulMod(const BigInt& lhs, const BigInt& rhs) const {
+    BigInt::LimbVector product = BigIntKernels::Multiply(lhs.bigIntVecChunks.data(), lhs.bigIntVecChunks.size(),
+        rhs.bigIntVecChunks.data(), rhs.bigIntVecChunks.size(), config);
+    return reduceMagnitude(product, lhs.isNegative != rhs.isNegative);
+}
+
+BigInt ModContext::powMod(const BigInt& base, const BigInt& exponent) const {
+    if (exponent.isNegative) {
+        throw std::invalid_argument("ModContext::powMod requires a non-negative exponent");
+    }
+    BigInt reducedBase = reduce(base);
+    BigInt::LimbVector baseScratch, exponentScratch;
+    BigInt::LimbVector result = BigIntKernels::PowMod(reducedBase.bigIntVecChunks.AsVector(baseScratch),
+        exponent.bigIntVecChunks.AsVector(exponentScratch), modulusChunks, &reciprocal, config);
+    if (result.empty()) {
+        result.push_back(0);
+    }
+    return BigInt(std::move(result));
+}
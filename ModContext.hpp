@@ -0,0 +1,55 @@
+/***************************************************************************************************
+* Module Name: ModContext Class Definition
+*
+* Date: October, 2026
+*
+* Module Description:
+*	The ModContext header provides the interface definition for the ModContext class, which holds
+*	a fixed modulus together with its Barrett reciprocal so that many reductions, modular products
+*	and modular powers by the same modulus share the cost of computing it.
+*
+* Notes:
+*   - The reciprocal floor(LIMB_BASE^(2n) / M) of an n-chunk modulus M is computed once, with the
+*	  Newton iteration of the division kernels, when the context is constructed. Each reduction of a
+*	  value below M^2 then costs two multiplications and a few subtractions, and longer values are
+*	  reduced block by block against the same reciprocal.
+*   - Barrett's reduction places no condition on the modulus, so even moduli, and others that share a
+*	  factor with the chunk base and so rule out Montgomery form, are handled the same way.
+*   - powMod still uses Montgomery multiplication for short moduli coprime to the chunk base, where the
+*	  kernels find it faster, and the cached reciprocal for every other modulus.
+*   - Results are always in [0, M), including for negative inputs.
+*   - The multiplication thresholds in effect when the context is constructed are used for all its
+*	  operations.
+*
+***************************************************************************************************/
+
+#pragma once
+#include <vector>
+#include "BigInt.hpp"
+#include "BigIntKernels.hpp"
+
+class ModContext {
+private:
+	// Magnitude of the modulus and floor(LIMB_BASE^(2n) / modulus) for its n chunks
+	BigInt::LimbVector modulusChunks;
+	BigInt::LimbVector reciprocal;
+	BigIntKernels::MultiplyConfig config;
+
+	// Returns the magnitude of value mod modulus as a BigInt in [0, modulus), flipped for negative values
+	BigInt reduceMagnitude(const BigInt::LimbVector& magnitude, bool isNegative) const;
+public:
+	// Precomputes the reciprocal of modulus. Throws std::invalid_argument if modulus is not positive.
+	ModContext(const BigInt& modulus);
+
+	// Functions to fetch class parameters
+	BigInt GetModulus() const;
+
+	// Returns value mod modulus in [0, modulus), for values of any size and sign
+	BigInt reduce(const BigInt& value) const;
+
+	// Returns lhs * rhs mod modulus in [0, modulus)
+	BigInt mulMod(const BigInt& lhs, const BigInt& rhs) const;
+
+	// Returns base ^ exponent mod modulus in [0, modulus). Throws std::invalid_argument for a negative exponent.
+	BigInt powMod(const BigInt& base, const BigInt& exponent) const;
+};
@@ -0,0 +1,77 @@
+/***************************************************************************************************
+* Module Name: Unit Tests for ModContext Class Methods using the Doctest Framework
+*
+* Date: October, 2026
+*
+* Module Description:
+*   This module focuses on testing the functionality of the ModContext class. The test cases are built
+*   upon the Doctest framework and check every reduction against the % operator and powMod of BigInt.
+*
+* Notes:
+*   - Moduli are picked to cover even moduli, moduli sharing a factor with the chunk base in either
+*     chunk mode, and values far longer than twice the modulus, which are reduced block by block.
+*
+***************************************************************************************************/
+
+#include "ModContext.hpp"
+#include "doctest.h"
+
+TEST_CASE("ModContext reduce matches the % operator for values of any size and sign...") {
+    BigInt value = BigInt("98765432109876543210987654321").powerOf(40);
+    for (std::string modulusStr : { "1", "7", "1000000000", "18446744073709551616", "123456789012345678901234567890" }) {
+        BigInt modulus(modulusStr);
+        ModContext context(modulus);
+        REQUIRE(context.GetModulus() == modulus);
+        REQUIRE(context.reduce(value) == value % modulus);
+        REQUIRE(context.reduce(modulus) == BigInt("0"));
+        REQUIRE(context.reduce(BigInt("5")) == BigInt("5") % modulus);
+
+        BigInt negativeRemainder = (-value) % modulus;
+        if (negativeRemainder.IsNegative()) {
+            negativeRemainder += modulus;
+        }
+        REQUIRE(context.reduce(-value) == negativeRemainder);
+        REQUIRE(context.reduce(-modulus) == BigInt("0"));
+    }
+}
+
+TEST_CASE("ModContext mulMod matches multiplication followed by the % operator...") {
+    BigInt modulus("340282366920938463463374607431768211456");
+    ModContext context(modulus);
+    BigInt lhs("12345678901234567890123456789012345678901234567890");
+    BigInt rhs("98765432109876543210987654321");
+    REQUIRE(context.mulMod(lhs, rhs) == (lhs * rhs) % modulus);
+    REQUIRE(context.mulMod(-lhs, rhs) == modulus - (lhs * rhs) % modulus);
+    REQUIRE(context.mulMod(lhs, BigInt("0")) == BigInt("0"));
+}
+
+TEST_CASE("ModContext powMod matches BigInt powMod for even and odd moduli...") {
+    BigInt base("123456789123456789");
+    BigInt exponent("1000");
+    BigInt fullPower = base.powerOf(1000);
+    for (std::string modulusStr : { "1000000000000000000000000000057", "1000000000000000000000000000000",
+        "98765432109876543210987654321098765432106", "18446744073709551616", "2" }) {
+        BigInt modulus(modulusStr);
+        ModContext context(modulus);
+        REQUIRE(context.powMod(base, exponent) == fullPower % modulus);
+        REQUIRE(context.powMod(base, exponent) == base.powMod(exponent, modulus));
+        REQUIRE(context.powMod(-base, BigInt("3")) == (-base).powMod(BigInt("3"), modulus));
+    }
+}
+
+TEST_CASE("ModContext powMod uses the reciprocal for moduli too long for Montgomery form...") {
+    // Over 10000 digits, which is past the Montgomery size limit in both chunk modes
+    BigInt modulus = BigInt("3").powerOf(21000) + 2;
+    ModContext context(modulus);
+    BigInt base = BigInt("7").powerOf(15000) + 11;
+    REQUIRE(context.powMod(base, BigInt("5")) == base.powerOf(5) % modulus);
+    REQUIRE(context.powMod(base, BigInt("5")) == base.powMod(BigInt("5"), modulus));
+}
+
+TEST_CASE("ModContext rejects moduli that are not positive and negative exponents...") {
+    REQUIRE_THROWS_AS(ModContext(BigInt("0")), std::invalid_argument);
+    REQUIRE_THROWS_AS(ModContext(BigInt("-7")), std::invalid_argument);
+    ModContext context(BigInt("7"));
+    REQUIRE_THROWS_AS(context.powMod(BigInt("5"), BigInt("-3")), std::invalid_argument);
+    REQUIRE(context.powMod(BigInt("5"), BigInt("0")) == BigInt("1"));
+}
@@ -0,0 +1,202 @@
+/***************************************************************************************************
+* Module Name: ScratchArena Class Implementation
+*
+* Date: October, 2026
+*
+* Module Description:
+*	This module contains the implementation details of the ScratchArena class, a per-thread bump
+*	allocator that serves the chunk buffers of the BigInt kernels while a Scope is open.
+*
+* Notes:
+*   - Size classes start at the alignment of std::max_align_t, so every buffer is aligned as operator
+*	  new would align it.
+*   - A block that cannot fit an allocation is left with its unused tail, and the allocation moves on
+*	  to the next spare block that fits it, or else to a new block.
+*
+***************************************************************************************************/
+
+#include "ScratchArena.hpp"
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+namespace {
+    const size_t ALIGNMENT = alignof(std::max_align_t);
+    const size_t MIN_BLOCK_BYTES = (size_t)64 << 10;
+
+    // Returns k for the smallest 2^k of at least bytes and ALIGNMENT bytes
+    size_t SizeClass(size_t bytes) {
+        size_t sizeClass = 0;
+        while (((size_t)1 << sizeClass) < std::max(bytes, ALIGNMENT)) {
+            sizeClass++;
+        }
+        return sizeClass;
+    }
+
+    // The arena of each thread is reached through a plain pointer, which stays readable while other thread_local
+    // and static objects are destroyed. Buffers those objects free after the arena is gone go back to the heap.
+    thread_local ScratchArena* threadArena = nullptr;
+
+    struct ThreadArenaOwner {
+        ~ThreadArenaOwner() {
+            delete threadArena;
+            threadArena = nullptr;
+        }
+    };
+}
+
+ScratchArena& ScratchArena::GetThreadArena() {
+    thread_local ThreadArenaOwner owner;
+    if (threadArena == nullptr) {
+        threadArena = new ScratchArena();
+    }
+    return *threadArena;
+}
+
+ScratchArena::~ScratchArena() {
+    for (const Block& block : blocks) {
+        ::operator delete(block.data);
+    }
+}
+
+ScratchArena::Scope::Scope() {
+    ScratchArena& arena = GetThreadArena();
+    wasActive = arena.isActive;
+    arena.isActive = true;
+    arena.scopeDepth++;
+}
+
+ScratchArena::Scope::~Scope() {
+    ScratchArena& arena = GetThreadArena();
+    arena.isActive = wasActive;
+    if (--arena.scopeDepth == 0) {
+        arena.reset();
+    }
+}
+
+ScratchArena::Suspend::Suspend() {
+    wasActive = IsActive();
+    if (wasActive) {
+        threadArena->isActive = false;
+    }
+}
+
+ScratchArena::Suspend::~Suspend() {
+    if (wasActive) {
+        threadArena->isActive = true;
+    }
+}
+
+void* ScratchArena::Allocate(size_t bytes) {
+    if (!IsActive()) {
+        return ::operator new(bytes);
+    }
+    return threadArena->allocateFromArena(SizeClass(bytes));
+}
+
+void ScratchArena::Deallocate(void* ptr, size_t bytes) {
+    // A thread that has never opened a Scope, or gave its blocks back, only has buffers from the heap
+    if (threadArena == nullptr || threadArena->blocks.empty()) {
+        ::operator delete(ptr);
+        return;
+    }
+    Block* block = threadArena->findOwner(ptr);
+    if (block == nullptr) {
+        ::operator delete(ptr);
+        return;
+    }
+    // Buffers freed after their Scope has closed were already taken back with it
+    if (threadArena->scopeDepth > 0) {
+        threadArena->deallocateToArena(*block, ptr, SizeClass(bytes));
+    }
+}
+
+bool ScratchArena::IsActive() {
+    return threadArena != nullptr && threadArena->isActive;
+}
+
+size_t ScratchArena::GetReservedBytes() {
+    size_t total = 0;
+    if (threadArena != nullptr) {
+        for (const Block& block : threadArena->blocks) {
+            total += block.capacity;
+        }
+    }
+    return total;
+}
+
+void ScratchArena::addBlock(size_t capacity) {
+    blocks.push_back({ static_cast<char*>(::operator new(capacity)), capacity, 0 });
+    std::pair<const char*, size_t> entry(blocks.back().data, blocks.size() - 1);
+    blocksByAddress.insert(std::upper_bound(blocksByAddress.begin(), blocksByAddress.end(), entry), entry);
+}
+
+void* ScratchArena::allocateFromArena(size_t sizeClass) {
+    if (freeLists[sizeClass] != nullptr) {
+        FreeBuffer* buffer = freeLists[sizeClass];
+        freeLists[sizeClass] = buffer->next;
+        return buffer;
+    }
+
+    size_t bytes = (size_t)1 << sizeClass;
+    while (currentBlock < blocks.size() && blocks[currentBlock].capacity - blocks[currentBlock].used < bytes) {
+        currentBlock++;
+    }
+    if (currentBlock == blocks.size()) {
+        size_t total = 0;
+        for (const Block& block : blocks) {
+            total += block.capacity;
+        }
+        addBlock(std::max({ bytes, MIN_BLOCK_BYTES, total }));
+    }
+
+    Block& block = blocks[currentBlock];
+    void* ptr = block.data + block.used;
+    block.used += bytes;
+    return ptr;
+}
+
+// The most recent allocation of the current block is handed back to it, and any other buffer is kept for reuse
+void ScratchArena::deallocateToArena(Block& block, void* ptr, size_t sizeClass) {
+    if (&block == &blocks[currentBlock] && (char*)ptr + ((size_t)1 << sizeClass) == block.data + block.used) {
+        block.used -= (size_t)1 << sizeClass;
+        return;
+    }
+    FreeBuffer* buffer = static_cast<FreeBuffer*>(ptr);
+    buffer->next = freeLists[sizeClass];
+    freeLists[sizeClass] = buffer;
+}
+
+// The only block that can own ptr is the last one starting at or below it
+ScratchArena::Block* ScratchArena::findOwner(const void* ptr) {
+    auto next = std::upper_bound(blocksByAddress.begin(), blocksByAddress.end(), (const char*)ptr,
+        [](const char* address, const std::pair<const char*, size_t>& entry) { return address < entry.first; });
+    if (next == blocksByAddress.begin()) {
+        return nullptr;
+    }
+    Block& block = blocks[std::prev(next)->second];
+    return ((const char*)ptr < block.data + block.capacity) ? &block : nullptr;
+}
+
+// Once nothing is allocated from the arena, every block is emptied, and several blocks are merged into one that
+// fits the same computation
+void ScratchArena::reset() {
+    std::fill(freeLists, freeLists + SIZE_CLASS_COUNT, nullptr);
+    currentBlock = 0;
+    size_t total = 0;
+    for (Block& block : blocks) {
+        block.used = 0;
+        total += block.capacity;
+    }
+    if (blocks.size() <= 1 && total <= MAX_RETAINED_BYTES) {
+        return;
+    }
+    for (const Block& block : blocks) {
+        ::operator delete(block.data);
+    }
+    blocks.clear();
+    blocksByAddress.clear();
+    if (total <= MAX_RETAINED_BYTES) {
+        addBlock(total);
+    }
+}
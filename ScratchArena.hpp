@@ -0,0 +1,124 @@
+/***************************************************************************************************
+* Module Name: ScratchArena Class Definition
+*
+* Date: October, 2026
+*
+* Module Description:
+*	The ScratchArena header provides a per-thread arena and pool allocator for the chunk buffers of
+*	the BigInt kernels, and the ScratchAllocator that routes std::vector allocations to it. While a
+*	Scope is open on a thread, every buffer the kernels create on that thread is carved out of a few
+*	large blocks instead of coming from the heap, and the whole region is handed back at once when
+*	the outermost Scope closes.
+*
+* Notes:
+*   - Each thread has its own arena, so threads that run many exponentiations at once never contend
+*	  for the heap lock while a Scope is open.
+*   - Sizes are rounded up to powers of two. The recursive kernels free most of their temporaries in
+*	  the reverse order they created them, and a buffer freed while it is the most recent one is given
+*	  back to the block right away. Any other freed buffer goes on a free list for its size, which the
+*	  next allocation of that size takes from first, so the arena stays within a small factor of the
+*	  peak live size of the computation.
+*   - The blocks are kept after the outermost Scope closes, merged into one block that is large enough
+*	  for the whole computation, so that repeating it does not allocate at all. Arenas larger than
+*	  MAX_RETAINED_BYTES are released instead.
+*   - Anything that must outlive a Scope, such as a result or a cached value, has to be allocated while
+*	  a Suspend is alive. Buffers from the heap can be freed inside a Scope and the other way around,
+*	  as deallocation looks up where each buffer came from, by binary search over the blocks sorted by
+*	  address. A thread without blocks frees straight to the heap.
+*
+***************************************************************************************************/
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+class ScratchArena {
+public:
+	// Arenas whose blocks add up to more than this are released when the outermost Scope closes
+	static const size_t MAX_RETAINED_BYTES = (size_t)64 << 20;
+
+	// Routes allocations on this thread to its arena until destroyed. Every buffer allocated inside must be gone or
+	// copied out by then.
+	class Scope {
+	private:
+		bool wasActive;
+	public:
+		Scope();
+		~Scope();
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+	};
+
+	// Sends allocations on this thread back to the heap until destroyed, for buffers that outlive the Scope
+	class Suspend {
+	private:
+		bool wasActive;
+	public:
+		Suspend();
+		~Suspend();
+		Suspend(const Suspend&) = delete;
+		Suspend& operator=(const Suspend&) = delete;
+	};
+
+	// Allocate from the arena of the calling thread while it has an open Scope, and from the heap otherwise
+	static void* Allocate(size_t bytes);
+	static void Deallocate(void* ptr, size_t bytes);
+
+	// Functions to fetch the state of the calling thread's arena
+	static bool IsActive();
+	static size_t GetReservedBytes();
+
+	~ScratchArena();
+private:
+	// Allocations are bumped from the front of a block, whose first used bytes are handed out
+	struct Block {
+		char* data;
+		size_t capacity;
+		size_t used;
+	};
+
+	// A freed buffer that is not the most recent allocation of its block, linked through its own first bytes
+	struct FreeBuffer {
+		FreeBuffer* next;
+	};
+	static const size_t SIZE_CLASS_COUNT = 64;
+
+	// Each new block is as large as all the earlier ones together, so a computation needs only a few of them.
+	// blocksByAddress pairs the start of every block with its index, sorted so that findOwner is a binary search.
+	// freeLists[k] holds the freed buffers of 2^k bytes.
+	std::vector<Block> blocks;
+	std::vector<std::pair<const char*, size_t>> blocksByAddress;
+	size_t currentBlock = 0;
+	FreeBuffer* freeLists[SIZE_CLASS_COUNT] = {};
+	bool isActive = false;
+	size_t scopeDepth = 0;
+
+	static ScratchArena& GetThreadArena();
+	void addBlock(size_t capacity);
+	void* allocateFromArena(size_t sizeClass);
+	void deallocateToArena(Block& block, void* ptr, size_t sizeClass);
+	Block* findOwner(const void* ptr);
+	void reset();
+};
+
+// Stateless allocator for std::vector that allocates through the calling thread's ScratchArena
+template <class T>
+class ScratchAllocator {
+public:
+	typedef T value_type;
+
+	ScratchAllocator() noexcept {}
+	template <class U>
+	ScratchAllocator(const ScratchAllocator<U>&) noexcept {}
+
+	T* allocate(size_t count) {
+		return static_cast<T*>(ScratchArena::Allocate(count * sizeof(T)));
+	}
+	void deallocate(T* ptr, size_t count) noexcept {
+		ScratchArena::Deallocate(ptr, count * sizeof(T));
+	}
+
+	template <class U>
+	bool operator==(const ScratchAllocator<U>&) const noexcept { return true; }
+};
@@ -0,0 +1,105 @@
+/***************************************************************************************************
+* Module Name: Unit Tests for ScratchArena Class Methods using the Doctest Framework
+*
+* Date: October, 2026
+*
+* Module Description:
+*   This module focuses on testing the functionality of the ScratchArena class. The test cases are
+*   built upon the Doctest framework and check where chunk buffers are allocated inside and outside
+*   a Scope, how freed buffers are reused, and that exponentiations running on several threads at
+*   once each get their own arena.
+*
+***************************************************************************************************/
+
+#include "ScratchArena.hpp"
+#include "BigInt.hpp"
+#include "doctest.h"
+#include <thread>
+
+TEST_CASE("ScratchArena Scope routes chunk buffers to the arena until it closes...") {
+    REQUIRE(!ScratchArena::IsActive());
+    BigInt::LimbVector heapBuffer(100, 1);
+    {
+        ScratchArena::Scope scope;
+        REQUIRE(ScratchArena::IsActive());
+        BigInt::LimbVector first(1000, 2);
+        REQUIRE(ScratchArena::GetReservedBytes() >= 1000 * sizeof(BigInt::Limb));
+        {
+            ScratchArena::Suspend suspend;
+            REQUIRE(!ScratchArena::IsActive());
+            heapBuffer.assign(first.begin(), first.end());
+        }
+        REQUIRE(ScratchArena::IsActive());
+
+        // The most recent buffer and buffers freed out of order are both handed out again
+        const BigInt::Limb* firstData = first.data();
+        first = BigInt::LimbVector();
+        BigInt::LimbVector second(1000, 3);
+        REQUIRE(second.data() == firstData);
+        BigInt::LimbVector third(1000, 4);
+        const BigInt::Limb* secondData = second.data();
+        second = BigInt::LimbVector();
+        BigInt::LimbVector fourth(1000, 5);
+        REQUIRE(fourth.data() == secondData);
+        REQUIRE(third[999] == 4);
+    }
+    REQUIRE(!ScratchArena::IsActive());
+    REQUIRE(heapBuffer.size() == 1000);
+    REQUIRE(heapBuffer[999] == 2);
+}
+
+TEST_CASE("ScratchArena finds the block of every freed buffer when it has several...") {
+    ScratchArena::Scope scope;
+    std::vector<BigInt::LimbVector> buffers;
+    BigInt::LimbVector heapBuffer;
+    {
+        ScratchArena::Suspend suspend;
+        heapBuffer.assign(5000, 7);
+    }
+    // Each buffer is larger than all the earlier ones together, so every one of them takes a new block
+    for (size_t chunkCount = 20000; chunkCount <= 320000; chunkCount *= 2) {
+        buffers.emplace_back(chunkCount, (BigInt::Limb)chunkCount);
+    }
+    size_t reservedBytes = ScratchArena::GetReservedBytes();
+    REQUIRE(reservedBytes >= 620000 * sizeof(BigInt::Limb));
+
+    // A buffer from an older block goes on the free list for its size, and the heap buffer back to the heap
+    const BigInt::Limb* olderData = buffers[1].data();
+    buffers[1] = BigInt::LimbVector();
+    heapBuffer = BigInt::LimbVector();
+    BigInt::LimbVector reused(40000, 1);
+    REQUIRE(reused.data() == olderData);
+    REQUIRE(buffers[3][0] == 160000);
+    REQUIRE(ScratchArena::GetReservedBytes() == reservedBytes);
+}
+
+TEST_CASE("ScratchArena keeps powerOf results valid after its Scope and reuses its blocks...") {
+    BigInt base("98765");
+    BigInt first = base.powerOf(3000);
+    size_t reservedBytes = ScratchArena::GetReservedBytes();
+    BigInt second = base.powerOf(3000);
+    REQUIRE(ScratchArena::GetReservedBytes() == reservedBytes);
+    REQUIRE(first == second);
+    REQUIRE(first == base.powerOf(1500).square());
+    REQUIRE(BigInt("-3").powerOf(5).GetBigIntFullString() == "-243");
+}
+
+TEST_CASE("ScratchArena gives each thread its own arena for concurrent exponentiations...") {
+    std::vector<BigInt> expected;
+    for (int i = 0; i < 4; i++) {
+        expected.push_back(BigInt(std::to_string(12345 + i)).powerOf(20000));
+    }
+    std::vector<BigInt> results(4);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&results, i]() {
+            results[i] = BigInt(std::to_string(12345 + i)).powerOf(20000);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < 4; i++) {
+        REQUIRE(results[i] == expected[i]);
+    }
+}
@@ -14,6 +14,9 @@
 *       2. It initiates the BigInt Arithmetic Application where users can interact with the command
 *          line, entering a value for A and receiving the resulting value for C in addition to information
 *          regarding how long the computation takes.
+*
+*   Passing "--last-digits k" on the command line makes the application compute only the last k digits of C,
+*   and "--leading-digits k" only its digit count and first k digits.
 ***************************************************************************************************/
 
 #define DOCTEST_CONFIG_IMPLEMENT
@@ -22,8 +25,34 @@
 
 #include "BigIntTest.cpp"
 #include "BigIntArithmeticAppTest.cpp"
+#include "ModContextTest.cpp"
+#include "ScratchArenaTest.cpp"
+
+int main(int argc, char* argv[]) {
+    // Parse the optional digit modes before anything runs, so a bad argument fails fast
+    size_t lastDigitCount = 0;
+    size_t leadingDigitCount = 0;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasCount = i + 1 < argc;
+        try {
+            if (arg == "--last-digits" && hasCount) {
+                lastDigitCount = BigIntArithmeticApp::ParseDigitCount(argv[++i]);
+                continue;
+            }
+            if (arg == "--leading-digits" && hasCount) {
+                leadingDigitCount = BigIntArithmeticApp::ParseDigitCount(argv[++i]);
+                continue;
+            }
+        }
+        catch (const std::invalid_argument& error) {
+            std::cerr << "Invalid digit count for " << arg << ": " << error.what() << std::endl;
+        }
+        std::cerr << "Usage: " << argv[0] << " [--last-digits k] [--leading-digits k], with k from 1 to "
+            << BigIntArithmeticApp::MAX_DIGIT_COUNT << std::endl;
+        return 1;
+    }
 
-int main() {
     // Run unit test framework
     doctest::Context context;
     int res = context.run(); // run all tests
@@ -32,7 +61,7 @@ int main() {
         return res;          // propagate the result of the tests
 
     // Begin application
-    BigIntArithmeticApp app;
+    BigIntArithmeticApp app(lastDigitCount, leadingDigitCount);
     app.Run();
 
     return res;
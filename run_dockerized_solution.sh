@@ -14,6 +14,6 @@ fi
 echo "Building Docker image with tag: $IMAGE_TAG"
 docker build -t $IMAGE_TAG .
 
-# Run the Docker container and attach the terminal to the instance
+# Run the Docker container and attach the terminal to the instance, passing on any arguments such as --last-digits k
 echo "Running new container with name: $CONTAINER_NAME"
-docker run -it --name $CONTAINER_NAME $IMAGE_TAG
\ No newline at end of file
+docker run -it --name $CONTAINER_NAME $IMAGE_TAG ./main "$@"
\ No newline at end of file